@@ -0,0 +1,333 @@
+//
+// Description:     Reflect, C++ 11 Reflection Library
+// Author:          Stephens Nunnally and Scidian Software
+// License:         Distributed under the MIT License
+// Source(s):       https://github.com/stevinz/reflect
+//
+// Copyright (c) 2021 Stephens Nunnally and Scidian Software
+//
+//
+//####################################################################################
+//##    Reflection Micro Benchmarks
+//##        Registers N synthetic structs with M int members each, reports ns/op and
+//##        allocations/op (calls to operator new and the library's REFLECT_MALLOC) for registration and lookups
+//####################################################################################
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+//####################################################################################
+//##    Allocation Counting
+//####################################################################################
+static std::atomic<size_t> g_allocations { 0 };
+
+// Library allocations (registry arena, SoAArray columns, ReflectPool slabs), routed here by REFLECT_MALLOC
+static void* CountedMalloc(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return malloc(size);
+}
+#define REFLECT_MALLOC(SIZE)    CountedMalloc(SIZE)
+#define REFLECT_FREE(PTR)       free(PTR)
+
+#define REGISTER_REFLECTION
+#include "reflect.h"
+
+// Every replaceable operator new / delete form is replaced, so all of them pair with the same malloc / free. Kept out
+// of line: once inlined into new / delete expressions GCC flags free() of an operator new pointer as mismatched.
+#if defined(__GNUC__)
+    #define BENCH_NOINLINE __attribute__((noinline))
+#else
+    #define BENCH_NOINLINE
+#endif
+BENCH_NOINLINE static void* CountedNew(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return malloc(size > 0 ? size : 1);
+}
+BENCH_NOINLINE static void CountedDelete(void* ptr) noexcept {
+    free(ptr);
+}
+void* operator new(size_t size) {
+    void* ptr = CountedNew(size);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+void* operator new[](size_t size) {
+    void* ptr = CountedNew(size);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept     { return CountedNew(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept   { return CountedNew(size); }
+void operator delete(void* ptr) noexcept                            { CountedDelete(ptr); }
+void operator delete[](void* ptr) noexcept                          { CountedDelete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept     { CountedDelete(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept   { CountedDelete(ptr); }
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* ptr, size_t) noexcept                    { CountedDelete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept                  { CountedDelete(ptr); }
+#endif
+
+//####################################################################################
+//##    Synthetic Types
+//####################################################################################
+// Member lists
+#define SYNTH_MEMBERS_4     m0, m1, m2, m3
+#define SYNTH_MEMBERS_16    m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15
+#define SYNTH_MEMBERS_64    m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, \
+                            m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, \
+                            m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, \
+                            m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63
+
+// Declares and registers one struct with the given int members
+#define SYNTH_FIELD(NAME) int NAME;
+#define SYNTH_CLASS(NAME, ...) \
+    struct NAME { \
+        REFLECT_FOR_EACH(SYNTH_FIELD, REFLECT_SEP_NONE, __VA_ARGS__) \
+        REFLECT(); \
+    }; \
+    REFLECT_CLASS(NAME) \
+        CLASS_META_DATA(META_DATA_DESCRIPTION, "Synthetic benchmark type.") \
+        CLASS_META_DATA("icon", "synthetic.png") \
+        CLASS_META_DATA(META_DATA_HIDDEN, false) \
+        REFLECT_FOR_EACH(REFLECT_MEMBER, REFLECT_SEP_NONE, __VA_ARGS__) \
+    REFLECT_END(NAME)
+
+// Repeats SYNTH_CLASS 64 / 256 times, names are PREFIX followed by base 4 digits (e.g. A_0000 ... A_3333)
+#define SYNTH_R4(P, ...)    SYNTH_CLASS(P##0, __VA_ARGS__) SYNTH_CLASS(P##1, __VA_ARGS__) SYNTH_CLASS(P##2, __VA_ARGS__) SYNTH_CLASS(P##3, __VA_ARGS__)
+#define SYNTH_R16(P, ...)   SYNTH_R4(P##0, __VA_ARGS__) SYNTH_R4(P##1, __VA_ARGS__) SYNTH_R4(P##2, __VA_ARGS__) SYNTH_R4(P##3, __VA_ARGS__)
+#define SYNTH_R64(P, ...)   SYNTH_R16(P##0, __VA_ARGS__) SYNTH_R16(P##1, __VA_ARGS__) SYNTH_R16(P##2, __VA_ARGS__) SYNTH_R16(P##3, __VA_ARGS__)
+#define SYNTH_R256(P, ...)  SYNTH_R64(P##0, __VA_ARGS__) SYNTH_R64(P##1, __VA_ARGS__) SYNTH_R64(P##2, __VA_ARGS__) SYNTH_R64(P##3, __VA_ARGS__)
+
+SYNTH_R256(A_, SYNTH_MEMBERS_4)
+SYNTH_R256(B_, SYNTH_MEMBERS_16)
+SYNTH_R64(C_, SYNTH_MEMBERS_64)                                                     // Fewer classes, keeps compile time down
+
+//####################################################################################
+//##    Benchmark Helpers
+//####################################################################################
+using Clock = std::chrono::steady_clock;
+
+static volatile size_t  g_sink      { 0 };                                          // Keeps results alive
+static const size_t     k_ops       { 1000000 };                                    // Operations per lookup benchmark
+static const int        k_sizes[]   { 16, 64, 256 };                                // Class counts (N) to scale registration over
+
+struct Group {
+    char                prefix;                                                     // Class name prefix ('A', 'B', 'C')
+    int                 member_count;                                               // Members per class (M)
+    RegisterList        entries;                                                    // Registration functions of group
+};
+
+struct Sample {
+    double              nanoseconds     { 0.0 };                                    // Total time
+    size_t              allocations     { 0 };                                      // Total operator new calls
+};
+
+template <typename Func>
+Sample Measure(Func func) {
+    Sample sample { };
+    size_t allocations = g_allocations.load(std::memory_order_relaxed);
+    Clock::time_point start = Clock::now();
+    func();
+    Clock::time_point end = Clock::now();
+    sample.nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    sample.allocations = g_allocations.load(std::memory_order_relaxed) - allocations;
+    return sample;
+}
+
+void Report(const char* name, int n, int m, const Sample& sample, size_t ops) {
+    printf("%-36s %6d %4d %14.1f %12.3f\n", name, n, m, sample.nanoseconds / ops, static_cast<double>(sample.allocations) / ops);
+}
+
+// Registers count classes of group, returns time / allocations of InitializeReflection() (per class)
+Sample MeasureRegistration(const Group& group, int count, Reflect_Init mode, bool touch) {
+    Sample total { };
+    const int repeats = 4096 / count;
+    for (int r = 0; r < repeats; ++r) {
+        g_reflect.reset();
+        g_register_list.assign(group.entries.begin(), group.entries.begin() + count);
+        Sample sample = Measure([&]() {
+            InitializeReflection(mode);
+            if (touch) {
+                for (int c = 0; c < count; ++c) g_sink += MemberInfos(group.entries[c].type_hash).size();
+            }
+        });
+        total.nanoseconds += sample.nanoseconds;
+        total.allocations += sample.allocations;
+    }
+    total.nanoseconds /= repeats;
+    total.allocations /= repeats;
+    return total;
+}
+
+//####################################################################################
+//##    Main
+//####################################################################################
+int main() {
+
+    // ########## Split registration list into groups by class name prefix
+    RegisterList all = g_register_list;
+    std::vector<Group> groups { { 'A', 4, { } }, { 'B', 16, { } }, { 'C', 64, { } } };
+    for (const RegisterEntry& entry : all) {
+        for (Group& group : groups) {
+            if (entry.name[0] == group.prefix) group.entries.push_back(entry);
+        }
+    }
+
+    printf("%-36s %6s %4s %14s %12s\n", "benchmark", "N", "M", "ns/op", "allocs/op");
+
+    // ########## Registration, op = one class
+    for (const Group& group : groups) {
+        for (int count : k_sizes) {
+            if (count > static_cast<int>(group.entries.size())) continue;
+            Report("InitializeReflection", count, group.member_count, MeasureRegistration(group, count, REFLECT_INIT_EAGER, false), count);
+            Report("InitializeReflection (parallel)", count, group.member_count, MeasureRegistration(group, count, REFLECT_INIT_PARALLEL, false), count);
+            Report("InitializeReflection (lazy)", count, group.member_count, MeasureRegistration(group, count, REFLECT_INIT_LAZY, false), count);
+            Report("InitializeReflection (lazy, touch)", count, group.member_count, MeasureRegistration(group, count, REFLECT_INIT_LAZY, true), count);
+        }
+    }
+
+    // ########## Lookups, all groups registered
+    g_reflect.reset();
+    g_register_list = all;
+    InitializeReflection();
+    const int n = static_cast<int>(all.size());
+
+    for (const Group& group : groups) {
+        const int m = group.member_count;
+        const int classes = static_cast<int>(group.entries.size());
+        std::vector<TypeHash> hashes;
+        std::vector<TypeID> ids;
+        std::vector<NameHash> name_hashes;
+        for (const RegisterEntry& entry : group.entries) {
+            hashes.push_back(entry.type_hash);
+            ids.push_back(entry.type_id);
+            name_hashes.push_back(NameHash(entry.name));
+        }
+        std::vector<std::string> member_names;
+        for (int i = 0; i < m; ++i) member_names.push_back("m" + std::to_string(i));
+
+        Report("ClassData by TypeHash", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += ClassData(hashes[i % classes]).member_count;
+        }), k_ops);
+        Report("ClassData by name", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += ClassData(group.entries[i % classes].name).member_count;
+        }), k_ops);
+        Report("ClassData by NameHash", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += ClassData(name_hashes[i % classes]).member_count;
+        }), k_ops);
+        Report("ClassDataByID", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += ClassDataByID(ids[i % classes]).member_count;
+        }), k_ops);
+        Report("MemberData by index", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += MemberData(hashes[i % classes], static_cast<int>(i % m)).offset;
+        }), k_ops);
+        Report("MemberData by name", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += MemberData(hashes[i % classes], member_names[i % m].c_str()).offset;
+        }), k_ops);
+        Report("GetMemberInfo by name", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += GetMemberInfo(hashes[i % classes], member_names[i % m].c_str()).offset;
+        }), k_ops);
+        Report("GetMeta int key", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += GetMetaData(ClassData(hashes[i % classes]), META_DATA_DESCRIPTION).size();
+        }), k_ops);
+        Report("GetMeta string key", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += GetMetaData(ClassData(hashes[i % classes]), "icon").size();
+        }), k_ops);
+        Report("GetMeta<bool> int key", n, m, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += GetMetaData<bool>(ClassData(hashes[i % classes]), META_DATA_HIDDEN) ? 1 : 0;
+        }), k_ops);
+    }
+
+    // ########## Member access, op = one member read through reflection
+    {
+        A_0000 a { };
+        B_0000 b { };
+        C_000 c { };
+        Report("ClassMember via MemberInfo", n, 4, Measure([&]() {
+            for (size_t i = 0; i < k_ops / 4; ++i) for (const MemberInfo& member : MemberInfos(a)) g_sink += ClassMember<int>(&a, member);
+        }), k_ops);
+        Report("ClassMember via MemberInfo", n, 16, Measure([&]() {
+            for (size_t i = 0; i < k_ops / 16; ++i) for (const MemberInfo& member : MemberInfos(b)) g_sink += ClassMember<int>(&b, member);
+        }), k_ops);
+        Report("ClassMember via MemberInfo", n, 64, Measure([&]() {
+            for (size_t i = 0; i < k_ops / 64; ++i) for (const MemberInfo& member : MemberInfos(c)) g_sink += ClassMember<int>(&c, member);
+        }), k_ops);
+        std::vector<MemberHandle<int>> handles;
+        for (int i = 0; i < 16; ++i) handles.push_back(MemberHandle<int>(TypeHashID<B_0000>(), ("m" + std::to_string(i)).c_str()));
+        Report("MemberHandle<int> access", n, 16, Measure([&]() {
+            for (size_t i = 0; i < k_ops / 16; ++i) for (const MemberHandle<int>& handle : handles) g_sink += handle(&b);
+        }), k_ops);
+        B_0000 b_copy = b;
+        Report("ReflectHash", n, 16, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += ReflectHash(b);
+        }), k_ops);
+        Report("ReflectEquals", n, 16, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += ReflectEquals(b, b_copy) ? 1 : 0;
+        }), k_ops);
+        Report("ClassData<T>() by type", n, 16, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += ClassData<B_0000>().member_count;
+        }), k_ops);
+    }
+
+    // ########## Batch iteration, op = one instance visited (all 16 members read through MemberInfo)
+    {
+        const size_t instances = 200000;
+        std::vector<B_0000> array(instances);
+        auto visit = [](void* instance, size_t, MemberInfoRange members) {
+            int sum = 0;
+            for (const MemberInfo& member : members) sum += ClassMember<int>(instance, member);
+            ClassMember<int>(instance, members[0]) = sum;
+        };
+        Report("ForEachInstanceParallel (1 thread)", n, 16, Measure([&]() {
+            ForEachInstanceParallel(array.data(), sizeof(B_0000), instances, TypeHashID<B_0000>(), visit, 1);
+        }), instances);
+        Report("ForEachInstanceParallel", n, 16, Measure([&]() {
+            ForEachInstanceParallel(array.data(), sizeof(B_0000), instances, TypeHashID<B_0000>(), visit);
+        }), instances);
+    }
+
+    // ########## Construction by TypeHash, op = one instance created and destroyed
+    {
+        const size_t batch = 1024;
+        std::vector<void*> instances(batch);
+        ReflectPool pool(TypeHashID<B_0000>(), batch);
+        Report("ReflectPool batch create / destroy", n, 16, Measure([&]() {
+            for (size_t i = 0; i < k_ops / batch; ++i) {
+                pool.Create(instances.data(), batch);
+                pool.Destroy(instances.data(), batch);
+            }
+        }), (k_ops / batch) * batch);
+        Report("operator new / delete", n, 16, Measure([&]() {
+            for (size_t i = 0; i < k_ops / batch; ++i) {
+                for (size_t j = 0; j < batch; ++j) instances[j] = new B_0000();
+                for (size_t j = 0; j < batch; ++j) delete static_cast<B_0000*>(instances[j]);
+            }
+        }), (k_ops / batch) * batch);
+    }
+
+    // ########## Meta data writes (after InitializeReflection writes publish a new list copy, measured last, then with
+    //            ReclaimMetaData() every 64 writes so released lists are reused)
+    {
+        const size_t writes = 10000;
+        TypeData& data = ClassData<A_0000>();
+        Report("SetMetaData int key (frozen)", n, 4, Measure([&]() {
+            for (size_t i = 0; i < writes; ++i) SetMetaData(data, META_DATA_TOOLTIP, static_cast<int>(i));
+        }), writes);
+        ReclaimMetaData();
+        Report("SetMetaData int key (frozen, reclaimed)", n, 4, Measure([&]() {
+            for (size_t i = 0; i < writes; ++i) {
+                SetMetaData(data, META_DATA_TOOLTIP, static_cast<int>(i));
+                if ((i & 63) == 63) ReclaimMetaData();
+            }
+        }), writes);
+        Report("GetMetaValue int key (after frozen writes)", n, 4, Measure([&]() {
+            for (size_t i = 0; i < k_ops; ++i) g_sink += static_cast<size_t>(GetMetaValue(data, META_DATA_TOOLTIP).integer);
+        }), k_ops);
+    }
+
+    return 0;
+}
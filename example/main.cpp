@@ -27,6 +27,19 @@
 // Demo Includes
 #include <iostream>
 
+// Visitor for ForEachMember(), called with member name and reference to each member variable
+struct PrintMember {
+    void print(const int& value)                    { std::cout << value; }
+    void print(const std::string& value)            { std::cout << value; }
+    void print(const std::vector<double>& value)    { for (size_t c = 0; c < value.size(); c++) std::cout << value[c] << ", "; }
+    template <typename MemberType>
+    void operator()(const char* name, MemberType& value) {
+        std::cout << "  Name: " << name << ", Value(s): ";
+        print(value);
+        std::cout << std::endl;
+    }
+};
+
 // Main
 int main(int argc, char* argv[]) {
 
@@ -80,14 +93,15 @@ int main(int argc, char* argv[]) {
     std::cout << "Transform2D instance 't' member variable values:" << std::endl;
 
     // EXAMPLE: Return member variable by class instance, member variable index
-    TypeData member = MemberData(t, 0);
+    //  (MemberInfo is the compact version of member TypeData, copying it never allocates)
+    MemberInfo member = GetMemberInfo(t, 0);
     if (member.type_hash == TypeHashID<int>()) {
         int& width = ClassMember<int>(&t, member);
-        std::cout << "  " << member.title << ": " << width << std::endl;
+        std::cout << "  " << MemberData(t, member.index).title << ": " << width << std::endl;
     }
 
     // EXAMPLE: Return member variable by class instance, member variable name
-    member = MemberData(t, "position");
+    member = GetMemberInfo(t, "position");
     if (member.type_hash == TypeHashID<std::vector<double>>()) {
         std::vector<double>& position = ClassMember<std::vector<double>>(&t, member);
         std::cout << "  " << MemberData(t, "position").title << " X: " << position[0] << std::endl;
@@ -96,7 +110,7 @@ int main(int argc, char* argv[]) {
     }
 
     // EXAMPLE: Return member variable by void* class, class type hash, and member variable name
-    member = MemberData(t_type_hash, "text");
+    member = GetMemberInfo(t_type_hash, "text");
     if (member.type_hash == TypeHashID<std::string>()) {
         std::string& txt = ClassMember<std::string>(&t, member);
         std::cout << "  " << MemberData(t_type_hash, "text").title << ": " << txt << std::endl;
@@ -105,15 +119,13 @@ int main(int argc, char* argv[]) {
 
     // ########## EXAMPLE: Iterating Members
     std::cout << "Iterating Members (member count: " << ClassData("Transform2D").member_count << "): " << std::endl;
-    for (int p = 0; p < ClassData("Transform2D").member_count; ++p) {
-        std::cout << "  Member Index: " << p << ", Name: " << MemberData(t, p).name << ", Value(s): ";
-        member = MemberData(t, p);
+    for (TypeData& member : Members(t)) {
+        std::cout << "  Member Index: " << member.index << ", Name: " << member.name << ", Value(s): ";
         if (member.type_hash == TypeHashID<int>()) {
             std::cout << ClassMember<int>(&t, member);                    
         } else 
-        if (member.type_hash == TypeHashID<std::vector<double>>()) {
-            std::vector<double> v = ClassMember<std::vector<double>>(&t, member);
-            for (size_t c = 0; c < v.size(); c++) std::cout << v[c] << ", ";
+        if ((member.flags & TYPE_FLAG_CONTAINER) && member.thunks->container->element_type_hash == TypeHashID<double>()) {
+            for (double value : MemberElements<double>(&t, GetMemberInfo(t, member.index))) std::cout << value << ", ";
         } else 
         if (member.type_hash == TypeHashID<std::string>()) {
             std::cout << ClassMember<std::string>(&t, member);
@@ -122,8 +134,20 @@ int main(int argc, char* argv[]) {
     }
 
 
+    // ########## EXAMPLE: Iterating Members with type erased member operations (no type checks)
+    std::cout << "Iterating Members with MemberToString: " << std::endl;
+    for (const MemberInfo& info : MemberInfos(t)) {
+        std::cout << "  Name: " << info.name << ", Value(s): " << MemberToString(&t, info) << std::endl;
+    }
+
+
+    // ########## EXAMPLE: Iterating Members at compile time (requires REFLECT_STATIC)
+    std::cout << "Iterating Members at compile time: " << std::endl;
+    ForEachMember(t, PrintMember());
+
+
     // ########## EXAMPLE: SetValue by Name (can also be called by class type / member variable index, etc...)
-    member = MemberData(t, "position");
+    member = GetMemberInfo(t, "position");
     if (member.type_hash == TypeHashID<std::vector<double>>()) {
         ClassMember<std::vector<double>>(&t, member) = { 56.0, 58.5, 60.2 };
         std::cout << "After calling SetValue on 'position':" << std::endl;
@@ -146,7 +170,7 @@ int main(int argc, char* argv[]) {
     //  access the member variables of the component back to the original type. This is done by using the saved_hash from earlier:                                                     
     //
     std::cout << "Getting member variable value from unknown class type:" << std::endl;
-    member = MemberData(saved_hash, 3);
+    member = GetMemberInfo(saved_hash, 3);
     if (member.type_hash == TypeHashID<std::vector<double>>()) {
         std::vector<double>& rotation = ClassMember<std::vector<double>>(component_ptr, member);
         std::cout << "  Rotation X: " << rotation[0] << ", Rotation Y: " << rotation[1] << ", Rotation Z: " << rotation[2] << std::endl;
@@ -28,6 +28,12 @@ struct Transform2D {
 	REFLECT();
 };
 
+// Compile time member descriptors, used by ForEachMember()
+REFLECT_STATIC(Transform2D, width, height, position, rotation, scale, text)
+
+// Stable (cross build / process) type id, usable at compile time as ReflectTypeID<Transform2D>::value
+REFLECT_TYPE_ID(Transform2D)
+
 
 //####################################################################################
 //##    Register Reflection / Meta Data
@@ -45,6 +45,7 @@
 //      - See (https://en.cppreference.com/w/cpp/types/is_standard_layout) for more info
 //
 // - BEFORE using reflection, make one call to 'InitializeReflection()'
+//      (or InitializeReflection(REFLECT_INIT_PARALLEL / REFLECT_INIT_LAZY) to register on worker threads / on first query)
 //
 //####################################################################################
 //
@@ -94,6 +95,12 @@
 //          TypeData data = MemberData(t, "width");             // By class instance, member name
 //          TypeData data = MemberData(type_hash, 0);           // By class type hash, member index
 //          TypeData data = MemberData(type_hash, "width");     // By class type hash, member name
+//          TypeData data = MemberData(type_hash, NameHash("width"));   // By precomputed member name hash
+//
+//      - All Members (contiguous, sorted by offset)
+//          MemberRange members = Members<Transform2D>();      // By class type
+//          MemberRange members = Members(t);                  // By class instance
+//          MemberRange members = Members(type_hash);          // By class type hash
 //
 //
 //      GET / SET MEMBER VARIABLE
@@ -104,8 +111,8 @@
 //      Before calling ClassMember<>(), member variable type can be checked by comparing to
 //      types using helper function TypeHashID<type_to_check>().
 //
-//      - Member Variable by Index
-//          TypeData member = MemberData(t, 0);
+//      - Member Variable by Index (MemberInfo is the compact, allocation free version of member TypeData)
+//          MemberInfo member = GetMemberInfo(t, 0);
 //          if (member.type_hash == TypeHashID<int>()) {
 //              // Create reference to member
 //              int& width = ClassMember<int>(&t, member);
@@ -114,7 +121,7 @@
 //          }
 //
 //      - Member Variable by Name
-//          TypeData member = MemberData(t, "position");
+//          TypeData& member = MemberData(t, "position");
 //          if (member.type_hash == TypeHashID<std::vector<double>>()) {
 //              // Create reference to member
 //              std::vector<double>& position = ClassMember<std::vector<double>>(&t, member);
@@ -123,9 +130,7 @@
 //          }
 //
 //      - Iterating Members / Properties
-//          int member_count = ClassData("Transform2D").member_count;
-//          for (int index = 0; index < member_count; ++index) {
-//              TypeData member = MemberData(t, index);
+//          for (TypeData& member : Members(t)) {
 //              std::cout << " Index: " << member.index << ", ";
 //              std::cout << " Name: " << member.name << ",";
 //              std::cout << " Value: ";
@@ -186,12 +191,37 @@
 #define SCID_REFLECT_H
 
 // Includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
-#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <unordered_map>
+#include <sstream>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
 #include <vector>
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+// Raw memory of the registry arena, SoAArray columns and ReflectPool slabs, define both before including reflect.h (in
+// every file) to route the library's own allocations through a custom allocator
+#ifndef REFLECT_MALLOC
+    #define REFLECT_MALLOC(SIZE)        malloc(SIZE)
+#endif
+#ifndef REFLECT_FREE
+    #define REFLECT_FREE(PTR)           free(PTR)
+#endif
 
 //####################################################################################
 //##    Sample Meta Data Enum
@@ -206,54 +236,689 @@ enum Meta_Data {
     // etc...
 };
 
+//####################################################################################
+//##    Type Flags
+//############################
+enum Type_Flags {
+    TYPE_FLAG_NONE =                    0,
+    TYPE_FLAG_TRIVIALLY_COPYABLE =      1 << 0,                                     // Type can be copied with memcpy
+    TYPE_FLAG_BITWISE_COMPARABLE =      1 << 1,                                     // Type has no padding and equal values have equal bytes, equality can be tested with memcmp (not floating point)
+    TYPE_FLAG_CONTAINER =               1 << 2,                                     // Type is a sequence container, see MemberThunks::container
+    TYPE_FLAG_ENUM =                    1 << 3,                                     // Type is an enum, names available through TryEnumData(type_hash) when reflected
+};
+
 //####################################################################################
 //##    Type Definitions
 //############################
 using TypeHash =        size_t;                                                     // This comes from typeid().hash_code()
+using TypeID =          uint64_t;                                                   // Stable type id, FNV-1a hash of class name (same across builds / processes)
 using Functions =       std::vector<std::function<void()>>;                         // List of functions
-using IntMap =          std::unordered_map<int, std::string>;                       // Meta data int key map
-using StringMap =       std::map<std::string, std::string>;                         // Meta data string key map
+
+// Registration function of a reflected class, added to g_register_list by REFLECT_END()
+struct RegisterEntry {
+    TypeHash            type_hash       { 0 };                                      // Class typeid().hash_code
+    TypeID              type_id         { 0 };                                      // Class stable type id
+    const char*         name            { "unknown" };                              // Class name
+    void                (*func)()       { nullptr };                                // Registers class and member variables
+};
+using RegisterList =    std::vector<RegisterEntry>;                                 // List of class registration functions
+using EnumRegisterList = std::vector<void(*)()>;                                    // List of enum registration functions
+
+// InitializeReflection() modes
+enum Reflect_Init {
+    REFLECT_INIT_EAGER = 0,                                                         // Register all classes, on calling thread
+    REFLECT_INIT_PARALLEL,                                                          // Register all classes, split across worker threads
+    REFLECT_INIT_LAZY,                                                              // Register each class the first time it is queried
+};
 
 //####################################################################################
 //##    Class / Member Type Data
 //############################
+// Type erased operations on a member variable, instantiated for the actual member type during registration.
+// All pointers are to the member variable itself (not the class), a function pointer is nullptr when the
+// member type does not support the operation.
+struct MemberThunks;
+// Type erased sequence container operations (std::vector, std::array, C arrays, user ContainerTraits<> specializations)
+struct ContainerThunks {
+    TypeHash            element_type_hash;                                          // typeid().hash_code of element type
+    size_t              element_size;                                               // sizeof element type
+    const MemberThunks* element_thunks;                                             // Type erased operations of element type
+    bool                contiguous;                                                 // Elements are stored as an array, data() is valid
+    size_t              (*size)(const void* container);                             // Element count
+    void*               (*data)(void* container);                                   // First element of contiguous storage, nullptr if not contiguous
+    void*               (*element)(void* container, size_t index);                  // Address of element, nullptr if elements are not addressable
+    bool                (*resize)(void* container, size_t count);                   // Resize, false if container has fixed size 'count' can't match
+};
+
+struct MemberThunks {
+    void                (*copy)(void* dst, const void* src);                        // Copy assign (dst = src)
+    void                (*move)(void* dst, void* src);                              // Move assign (dst = std::move(src))
+    bool                (*equal)(const void* a, const void* b);                     // Compare (a == b)
+    void                (*construct)(void* member);                                 // Default construct in place (placement new)
+    void                (*destroy)(void* member);                                   // Call destructor
+    std::string         (*to_string)(const void* member);                           // Convert value to string
+    bool                (*from_string)(void* member, const std::string& text);      // Parse value from string, false on failure
+    size_t              (*hash)(const void* member);                                // Hash of value
+    void                (*write)(std::vector<char>& out, const void* member);       // Append binary encoding of value
+    bool                (*read)(const char* data, size_t length, void* member);     // Decode binary encoding of value, false on failure
+    const ContainerThunks* container;                                               // Container operations, nullptr if not a container
+};
+
+// Types of values meta data can hold
+enum Meta_Type {
+    META_TYPE_NONE = 0,                                                             // No meta data stored
+    META_TYPE_STRING,                                                               // std::string
+    META_TYPE_BOOL,                                                                 // bool
+    META_TYPE_INT,                                                                  // Integers and enums (as int64_t)
+    META_TYPE_FLOAT,                                                                // float / double (as double)
+    META_TYPE_RANGE,                                                                // MetaRange
+    META_TYPE_FUNCTION,                                                             // Function pointer
+};
+
+// Min / max range meta data value (e.g. slider limits)
+struct MetaRange {
+    double              min;                                                        // Minimum value
+    double              max;                                                        // Maximum value
+};
+
+// Small tagged variant holding a single meta data value, only string values allocate
+struct MetaValue {
+    int                 type            { META_TYPE_NONE };                         // Meta_Type of stored value
+    union {
+        int64_t         integer         { 0 };                                      // META_TYPE_BOOL / META_TYPE_INT
+        double          number;                                                     // META_TYPE_FLOAT
+        MetaRange       range;                                                      // META_TYPE_RANGE
+        void            (*function)();                                              // META_TYPE_FUNCTION
+    };
+    std::string         string          { };                                        // META_TYPE_STRING
+
+    MetaValue() { }
+    MetaValue(const char* value)        : type(META_TYPE_STRING), string(value) { }
+    MetaValue(const std::string& value) : type(META_TYPE_STRING), string(value) { }
+    MetaValue(bool value)               : type(META_TYPE_BOOL), integer(value ? 1 : 0) { }
+    MetaValue(MetaRange value)          : type(META_TYPE_RANGE) { range = value; }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, int>::type = 0>
+    MetaValue(T value)                  : type(META_TYPE_INT), integer(static_cast<int64_t>(value)) { }
+    template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    MetaValue(T value)                  : type(META_TYPE_FLOAT) { number = static_cast<double>(value); }
+    template <typename Ret, typename... Args>
+    MetaValue(Ret (*value)(Args...))    : type(META_TYPE_FUNCTION) { function = reinterpret_cast<void (*)()>(value); }
+};
+
+// Typed access to value, returns fallback when stored type can't be converted (strings are never parsed)
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, int>::type = 0>
+T MetaValueAs(const MetaValue& value, T fallback) {
+    switch (value.type) {
+        case META_TYPE_BOOL:
+        case META_TYPE_INT:     return static_cast<T>(value.integer);
+        case META_TYPE_FLOAT:   return static_cast<T>(value.number);
+        default:                return fallback;
+    }
+}
+inline MetaRange MetaValueAs(const MetaValue& value, MetaRange fallback)                    { return (value.type == META_TYPE_RANGE) ? value.range : fallback; }
+inline std::string MetaValueAs(const MetaValue& value, const std::string& fallback)        { return (value.type == META_TYPE_STRING) ? value.string : fallback; }
+template <typename Ret, typename... Args>
+Ret (*MetaValueAs(const MetaValue& value, Ret (*fallback)(Args...)))(Args...) {
+    return (value.type == META_TYPE_FUNCTION) ? reinterpret_cast<Ret (*)(Args...)>(value.function) : fallback;
+}
+
+// Single meta data value, string keys are stored by hash (key names are interned once in SnReflect::meta_keys)
+struct MetaEntry {
+    size_t              key             { 0 };                                      // Int key, or FNV-1a hash of string key
+    bool                string_key      { false };                                  // True if key is a string key hash
+    MetaValue           value           { };                                        // Meta data
+};
+using MetaList =        std::vector<MetaEntry>;                                     // Flat meta data array, sorted by (string_key, key)
+
+// Meta data list published after InitializeReflection(), one sorted copy per owner is swapped in on every write
+// (read copy update), replaced lists are kept by the registry until ReclaimMetaData() so values returned by reference stay valid
+struct MetaSnapshot {
+    std::atomic<const MetaList*> list   { nullptr };                                // Current list, nullptr if never written after freeze
+    MetaSnapshot() = default;
+    MetaSnapshot(const MetaSnapshot& other) : list(other.list.load(std::memory_order_acquire)) { }
+    MetaSnapshot& operator=(const MetaSnapshot& other) { list.store(other.list.load(std::memory_order_acquire), std::memory_order_release); return *this; }
+};
+
 struct TypeData {
     std::string         name            { "unknown" };                              // Actual struct / class / member variable name
     std::string         title           { "unknown" };                              // Pretty (capitalized, spaced) name for displaying in gui
+    const char*         name_literal    { nullptr };                                // Name literal of registration macro (#TYPE / #MEMBER), nullptr if built at runtime
     TypeHash            type_hash       { 0 };                                      // Underlying typeid().hash_code of actual type
-    IntMap              meta_int_map    { };                                        // Map to hold user meta data by int key
-    StringMap           meta_string_map { };                                        // Map to hold user meta data by string key
+    TypeID              type_id         { 0 };                                      // Stable type id of class (FNV-1a hash of class name), 0 for members
+    MetaList            meta_data       { };                                        // User meta data by int / string key (empty list does not allocate)
+    MetaSnapshot        meta_snapshot   { };                                        // Meta data written after InitializeReflection(), replaces 'meta_data'
     // For Class Data
     int                 member_count    { 0 };                                      // Number of registered member variables of class
+    uint64_t            fingerprint     { 0 };                                      // Binary schema fingerprint of class, see ReflectFingerprint()
     // For Member Data
     int                 index           { -1 };                                     // Index of member variable within parent class / struct
     int                 offset          { 0 };                                      // Char* offset of member variable within parent class / struct
+    size_t              size            { 0 };                                      // Size of actual type of member variable (or class)
+    const MemberThunks* thunks          { nullptr };                                // Type erased operations for actual type of member variable (classes: construct / destroy)
+    // For Class / Member Data
+    size_t              alignment       { 0 };                                      // Alignment of actual type of class / member variable
+    int                 flags           { TYPE_FLAG_NONE };                         // Type_Flags of actual type of class / member variable
+    uint64_t            descriptor      { 0 };                                      // Stable type descriptor of actual type, see TypeDescriptor<T>
+};
+
+// One named enum value, in declaration order
+struct EnumValueData {
+    std::string         name            { "unknown" };                              // Actual enum value name
+    std::string         title           { "unknown" };                              // Pretty (capitalized, spaced) name for displaying in gui
+    int64_t             value           { 0 };                                      // Enum value
+};
+// Reflected enum, value -> name is an array index when values are dense (otherwise hashed), name -> value is hashed
+struct EnumData {
+    std::string         name            { "unknown" };                              // Actual enum name
+    std::string         title           { "unknown" };                              // Pretty (capitalized, spaced) name for displaying in gui
+    TypeHash            type_hash       { 0 };                                      // Underlying typeid().hash_code of enum
+    size_t              size            { 0 };                                      // sizeof enum
+    std::vector<EnumValueData> values   { };                                        // Named values, in declaration order
+    // Lookup tables, built when enum is registered
+    int64_t             dense_min       { 0 };                                      // Value of first entry of 'dense'
+    std::vector<int>    dense           { };                                        // Index into 'values' by (value - dense_min), -1 if no name
+    std::unordered_map<int64_t, int> sparse { };                                    // Index into 'values' by value, used when 'dense' is empty
+    std::unordered_map<size_t, int> names { };                                      // Index into 'values' by name hash
+};
+
+// Compact, trivially copyable member description for hot paths (no heap allocations to copy or access). The
+// matching TypeData (in SnReflect::members) is the cold side table holding title and meta data of the member.
+struct MemberInfo {
+    TypeHash            type_hash       { 0 };                                      // Underlying typeid().hash_code of actual type
     size_t              size            { 0 };                                      // Size of actual type of member variable
+    const char*         name            { "unknown" };                              // Actual member variable name (registration literal, or interned in registry arena)
+    int                 offset          { 0 };                                      // Char* offset of member variable within parent class / struct
+    int                 index           { -1 };                                     // Index of member variable within parent class / struct
+    const MemberThunks* thunks          { nullptr };                                // Type erased operations for actual type of member variable
+    int                 flags           { TYPE_FLAG_NONE };                         // Type_Flags of actual type of member variable
+    uint64_t            descriptor      { 0 };                                      // Stable type descriptor of actual type, see TypeDescriptor<T>
+};
+
+// Contiguous view of a class's members (sorted by offset) or plan steps, allows range based for loops
+template <typename Type>
+struct ReflectRange {
+    Type*               first           { nullptr };                                // First member of class
+    Type*               last            { nullptr };                                // One past last member of class
+    Type*               begin() const   { return first; }
+    Type*               end() const     { return last; }
+    int                 size() const    { return static_cast<int>(last - first); }
+    bool                empty() const   { return first == last; }
+    Type&               operator[](int index) const { return first[index]; }
+};
+using MemberRange =     ReflectRange<TypeData>;                                     // Range of member TypeData
+using MemberInfoRange = ReflectRange<const MemberInfo>;                             // Range of member MemberInfo
+
+// Single step of a class copy plan, adjacent trivially copyable members are merged into one memcpy run
+struct CopyOp {
+    int                 offset          { 0 };                                      // Char* offset of run / member within class
+    int                 size            { 0 };                                      // Size in bytes of run / member
+    void                (*copy)(void* dst, const void* src) { nullptr };            // Member copy thunk, nullptr for memcpy run
+};
+
+// Precomputed steps to copy all registered members of a class
+struct CopyPlan {
+    ReflectRange<const CopyOp> ops      { };                                        // Copy steps, sorted by offset (arena allocated)
+    bool                complete        { true };                                   // False if some member could not be copied
+};
+
+// Single step of a class compare plan, adjacent bitwise comparable members are merged into one memcmp run
+struct CompareOp {
+    int                 offset          { 0 };                                      // Char* offset of run / member within class
+    int                 size            { 0 };                                      // Size in bytes of run / member
+    int                 first_member    { 0 };                                      // Index of first member covered by step
+    int                 member_count    { 0 };                                      // Number of members covered by step
+    bool                (*equal)(const void* a, const void* b) { nullptr };         // Member compare thunk, nullptr for memcmp
+    size_t              (*hash)(const void* member) { nullptr };                    // Member hash thunk (with 'equal'), nullptr hashes run bytes
+    bool                comparable      { true };                                   // False if member can not be compared (always different)
+};
+
+// Precomputed steps to compare all registered members of a class
+struct ComparePlan {
+    ReflectRange<const CompareOp> ops   { };                                        // Compare steps, sorted by offset (arena allocated)
+};
+
+// Single step of a migration plan (loading binary records written with an older / newer schema)
+enum Migrate_Op {
+    MIGRATE_COPY = 0,                                                               // Raw bytes copied into class, adjacent runs merged
+    MIGRATE_SKIP,                                                                   // Raw bytes of removed / incompatible member skipped
+    MIGRATE_READ,                                                                   // Blob decoded by member read thunk
+    MIGRATE_SKIP_BLOB,                                                              // Blob of removed / incompatible member skipped
+    MIGRATE_CONVERT,                                                                // Stored raw bytes / blob passed to user converter
+    MIGRATE_DEFAULT,                                                                // Member missing from stored records reset to default value
+};
+using MigrateConvertFunc = bool (*)(const char* data, size_t length, void* member);  // Converts stored bytes / blob into member
+struct MigrateOp {
+    uint8_t             op              { MIGRATE_SKIP };                           // Migrate_Op of step
+    uint8_t             encoding        { 0 };                                      // Binary_Encoding of stored data
+    int                 offset          { -1 };                                     // Char* offset of member within class
+    uint32_t            size            { 0 };                                      // Size of stored raw run in bytes
+    MigrateConvertFunc  read            { nullptr };                                // Read thunk / converter for MIGRATE_READ / MIGRATE_CONVERT
+    const MemberThunks* thunks          { nullptr };                                // Member thunks for MIGRATE_DEFAULT
+};
+
+// Precomputed steps to load records of one stored schema into the current class layout
+struct MigrationPlan {
+    uint64_t            from            { 0 };                                      // Fingerprint of stored schema
+    uint64_t            to              { 0 };                                      // Fingerprint of current class schema
+    std::vector<MigrateOp> ops          { };                                        // Record steps in stored order, then defaults
+};
+
+// Stored member rename / conversion, see AddMigrationRule()
+struct MigrationRule {
+    std::string         member          { };                                        // Current member to load stored member into
+    MigrateConvertFunc  convert         { nullptr };                                // Converter, nullptr to load as is
+};
+
+// Bitset of member indices, the first k_inline_members indices are stored inline (no heap allocation), larger indices
+// (classes with more members) spill into a heap array
+class MemberMask
+{
+public:
+    static const int    k_inline_members = 256;                                     // Member indices stored without allocating
+    static const int    k_inline_words = k_inline_members / 64;                     // Number of inline 64 bit words
+    void                Set(int index)          { if (index >= 0) WordRef(index >> 6) |= (1ULL << (index & 63)); }
+    void                Reset(int index)        { if (index >= 0 && (index >> 6) < Words()) WordRef(index >> 6) &= ~(1ULL << (index & 63)); }
+    bool                Test(int index) const   { return index >= 0 && (Word(index >> 6) & (1ULL << (index & 63))) != 0; }
+    void                Clear()                 { for (uint64_t& word : m_bits) word = 0; m_extra.clear(); }
+    bool                Any() const             { for (int w = 0; w < Words(); ++w) if (Word(w) != 0) return true; return false; }
+    int                 Words() const           { return k_inline_words + static_cast<int>(m_extra.size()); }
+    uint64_t            Word(int word) const {
+        if (word < k_inline_words) return m_bits[word];
+        size_t extra = static_cast<size_t>(word - k_inline_words);
+        return (extra < m_extra.size()) ? m_extra[extra] : 0;
+    }
+    void                SetWord(int word, uint64_t bits) { if (bits != 0 || word < Words()) WordRef(word) = bits; }
+private:
+    uint64_t&           WordRef(int word) {
+        if (word < k_inline_words) return m_bits[word];
+        size_t extra = static_cast<size_t>(word - k_inline_words);
+        if (extra >= m_extra.size()) m_extra.resize(extra + 1, 0);
+        return m_extra[extra];
+    }
+    uint64_t            m_bits[k_inline_words] { };                                  // Bits, member index 0 is lowest bit of first word
+    std::vector<uint64_t> m_extra       { };                                        // Words past k_inline_words, empty for most classes
 };
 
 // Empty TypeData to return by reference on GetTypeData() fail
 static TypeData         unknown_type    { };
+// Empty MemberInfo to return by reference on GetMemberInfo() fail
+static const MemberInfo unknown_member  { };
+
+
+// String hashing (FNV-1a), used for name indexes
+size_t          HashString(const char* str);
+
+// Compile time FNV-1a hash of a string literal, same value as HashString()
+constexpr uint64_t HashStringFNV1a(const char* str, uint64_t hash = 14695981039346656037ULL) {
+    return (*str == '\0') ? hash : HashStringFNV1a(str + 1, (hash ^ static_cast<unsigned char>(*str)) * 1099511628211ULL);
+}
+
+// Precomputed name hash, declare as constexpr so hot call sites do no hashing at runtime:
+//      constexpr NameHash k_position { "position" };
+//      TypeData& member = MemberData(type_hash, k_position);
+struct NameHash {
+    size_t              value           { 0 };                                      // FNV-1a hash of name
+    constexpr explicit NameHash(const char* name) : value(static_cast<size_t>(HashStringFNV1a(name))) { }
+};
+
+// Compile time stable type id, specialized by REFLECT_TYPE_ID(TYPE) (place next to the struct, outside of
+// #ifdef REGISTER_REFLECTION). Equal to TypeData::type_id, use it in saved data / network packets / shared memory:
+//      constexpr TypeID k_transform_id = ReflectTypeID<Transform2D>::value;
+//      TypeData& data = ClassDataByID(k_transform_id);
+template <typename T>
+struct ReflectTypeID {
+    static constexpr bool   declared = false;
+    static constexpr TypeID value = 0;
+};
+#define REFLECT_TYPE_ID(TYPE) \
+    template <> struct ReflectTypeID<TYPE> { \
+        static constexpr bool   declared = true; \
+        static constexpr TypeID value = HashStringFNV1a(#TYPE); \
+    };
 
 //####################################################################################
 //##    SnReflect
 //##        Singleton to hold Class / Member reflection and meta data
 //############################
+// Bump allocator for registry tables that live as long as the registry (nothing is freed individually), only
+// trivially destructible types may be allocated from it
+class ReflectArena
+{
+public:
+    ReflectArena() = default;
+    ReflectArena(const ReflectArena&) = delete;
+    ReflectArena& operator=(const ReflectArena&) = delete;
+    ~ReflectArena() { for (char* block : m_blocks) REFLECT_FREE(block); }
+
+    void* Allocate(size_t size, size_t alignment) {
+        size_t padding = (alignment - (reinterpret_cast<uintptr_t>(m_cursor) & (alignment - 1))) & (alignment - 1);
+        if (m_cursor == nullptr || padding + size > m_remaining) {
+            size_t block_size = (size + alignment > k_block_size) ? (size + alignment) : k_block_size;
+            char* block = static_cast<char*>(REFLECT_MALLOC(block_size));
+            assert(block != nullptr && "Reflection arena out of memory!");
+            m_blocks.push_back(block);
+            m_cursor = block;
+            m_remaining = block_size;
+            padding = (alignment - (reinterpret_cast<uintptr_t>(m_cursor) & (alignment - 1))) & (alignment - 1);
+        }
+        char* result = m_cursor + padding;
+        m_cursor += padding + size;
+        m_remaining -= padding + size;
+        m_used += size;
+        return result;
+    }
+    template <typename T>
+    T* AllocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena types are never destroyed!");
+        T* items = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        for (size_t i = 0; i < count; ++i) new (items + i) T();
+        return items;
+    }
+    // Copies string into the arena, result is null terminated
+    const char* Intern(const char* str, size_t length) {
+        char* copy = static_cast<char*>(Allocate(length + 1, 1));
+        memcpy(copy, str, length);
+        copy[length] = '\0';
+        return copy;
+    }
+    size_t BytesUsed() const        { return m_used; }
+
+private:
+    static const size_t k_block_size = 16 * 1024;                                   // Default block size
+    std::vector<char*>  m_blocks        { };                                        // Allocated blocks
+    char*               m_cursor        { nullptr };                                // Next free byte in current block
+    size_t              m_remaining     { 0 };                                      // Free bytes in current block
+    size_t              m_used          { 0 };                                      // Bytes handed out
+};
+
+// Class waiting for lazy registration (REFLECT_INIT_LAZY)
+struct LazyClass {
+    void                (*func)()       { nullptr };                                // Registration function
+    std::atomic<bool>   registered      { false };                                  // True once class tables are filled
+};
+
 class SnReflect
 {
 public:
+    SnReflect() = default;
+    SnReflect(const SnReflect&) = delete;
+    SnReflect& operator=(const SnReflect&) = delete;
+
     std::unordered_map<TypeHash, TypeData>                  classes     { };        // Holds data about classes / structs
-    std::unordered_map<TypeHash, std::map<int, TypeData>>   members     { };        // Holds data about member variables (of classes)
+    std::unordered_map<TypeHash, std::vector<TypeData>>     members     { };        // Holds data about member variables (of classes), sorted by offset
+    std::unordered_map<size_t, TypeData*>                   class_names { };        // Index of class name hash to class TypeData (points into 'classes')
+    std::unordered_map<TypeID, TypeData*>                   type_ids    { };        // Index of stable type id to class TypeData (points into 'classes')
+    std::unordered_map<TypeHash, std::unordered_map<size_t, int>> member_names { };   // Index of member name hash to member index, per class
+    std::unordered_map<TypeHash, MemberInfoRange>           member_info { };        // Hot member data (parallel to 'members', arena allocated), built by Finalize()
+    std::unordered_map<TypeHash, std::unordered_map<size_t, MemberInfo>> member_paths { };  // Flattened member paths by path hash, per class, built by Finalize()
+    std::unordered_map<TypeHash, EnumData>                  enums       { };        // Holds data about reflected enums
+    std::unordered_map<TypeHash, CopyPlan>                  copy_plans  { };        // Per class copy plans, built by Finalize()
+    std::unordered_map<TypeHash, ComparePlan>               compare_plans { };      // Per class compare plans, built by Finalize()
+    bool                                                    frozen      { false };  // True after Finalize(), tables above are read only
+    bool                                                    lazy        { false };  // True if classes are registered on first query
+    std::unordered_map<TypeHash, LazyClass>                 lazy_classes { };       // Classes not yet registered (REFLECT_INIT_LAZY)
+    std::mutex                                              lazy_mutex  { };        // Serializes lazy registration
+    std::unordered_map<const TypeData*, std::unique_ptr<MetaList>> meta_lists { };  // Owns current meta data list of each owner written after freeze (see MetaSnapshot)
+    std::vector<std::unique_ptr<MetaList>>                  meta_retired { };       // Replaced meta data lists, released by ReclaimMetaData()
+    std::vector<std::unique_ptr<MetaList>>                  meta_free   { };        // Reclaimed lists reused by later writes (keeps their capacity)
+    std::mutex                                              meta_mutex  { };        // Serializes meta data writes after freeze
+    ReflectArena                                            arena       { };        // Storage for hot tables and interned member names
+    std::unordered_map<size_t, std::string>                 meta_keys   { };        // Interned string meta data key names by key hash
+    std::mutex                                              meta_key_mutex { };     // Guards 'meta_keys'
+    uint64_t                                                generation  { 0 };      // Registry generation, changes with every InitializeReflection()
+    std::unordered_map<uint64_t, MigrationPlan*>            migration_plans { };    // Migration plans by class / stored fingerprint
+    std::vector<std::unique_ptr<MigrationPlan>>             migration_storage { };  // Owns plans, kept when a plan is replaced
+    std::unordered_map<uint64_t, MigrationRule>             migration_rules { };    // Migration rules by class / stored member name
+    std::mutex                                              migration_mutex { };    // Guards migration tables
+    std::unordered_map<TypeHash, std::atomic<uint64_t>>     class_lookups { };      // Lookup counts per class (only counted with REFLECT_ENABLE_STATS)
 
 public:
-    void AddClass(TypeData class_data) {
+    void AddClass(const TypeData& class_data) {
+        assert(!frozen && "Registry is frozen, classes must be registered before InitializeReflection() completes!");
         assert(class_data.type_hash != 0 && "Class type hash is 0, error in registration?");
-        classes[class_data.type_hash] = class_data;
+        TypeData& data = classes[class_data.type_hash];
+        data = class_data;
+        IndexClass(data);
     }
-    void AddMember(TypeData class_data, TypeData member_data) {
+    // Adds class to name / stable type id indexes
+    void IndexClass(TypeData& data) {
+        TypeData*& named = class_names[HashString(data.name.c_str())];
+        assert((named == nullptr || named == &data) && "Class name hash collision, two classes hash to the same name!");
+        named = &data;
+        if (data.type_id == 0) return;
+        TypeData*& id = type_ids[data.type_id];
+        assert((id == nullptr || id == &data) && "Stable type id collision, two classes hash to the same type id!");
+        id = &data;
+    }
+    void AddMember(const TypeData& class_data, const TypeData& member_data) {
+        assert(!frozen && "Registry is frozen, members must be registered before InitializeReflection() completes!");
         assert(class_data.type_hash != 0 && "Class type hash is 0, error in registration?");
         assert(classes.find(class_data.type_hash) != classes.end() && "Class never registered with AddClass before calling AddMember!");
-        members[class_data.type_hash][member_data.offset] = member_data;
-        classes[class_data.type_hash].member_count = members[class_data.type_hash].size();
+        // Keep members sorted by offset, so index lookups are O(1) and iteration walks memory in order
+        std::vector<TypeData>& class_members = members[class_data.type_hash];
+        auto it = std::lower_bound(class_members.begin(), class_members.end(), member_data.offset,
+            [](const TypeData& member, int offset) { return member.offset < offset; });
+        std::unordered_map<size_t, int>& names = member_names[class_data.type_hash];
+        if (it != class_members.end() && it->offset == member_data.offset) {
+            // Same offset (union members), later registration replaces the member, keeps its index, renames it
+            int index = it->index;
+            names.erase(HashString(it->name.c_str()));
+            *it = member_data;
+            it->index = index;
+            int& named = names.insert(std::make_pair(HashString(it->name.c_str()), -1)).first->second;
+            assert(named == -1 && "Member name hash collision, two members of class hash to the same name!");
+            named = index;
+            return;
+        }
+        if (it == class_members.end()) {
+            // Members are usually registered in declaration (offset) order, appending keeps all other indices
+            class_members.push_back(member_data);
+            class_members.back().index = static_cast<int>(class_members.size() - 1);
+            int& named = names.insert(std::make_pair(HashString(member_data.name.c_str()), -1)).first->second;
+            assert(named == -1 && "Member name hash collision, two members of class hash to the same name!");
+            named = class_members.back().index;
+            classes[class_data.type_hash].member_count = static_cast<int>(class_members.size());
+            return;
+        }
+        class_members.insert(it, member_data);
+
+        // Update indices and member name index after insert
+        names.clear();
+        for (size_t i = 0; i < class_members.size(); ++i) {
+            class_members[i].index = static_cast<int>(i);
+            int& named = names.insert(std::make_pair(HashString(class_members[i].name.c_str()), -1)).first->second;
+            assert(named == -1 && "Member name hash collision, two members of class hash to the same name!");
+            named = static_cast<int>(i);
+        }
+        classes[class_data.type_hash].member_count = static_cast<int>(class_members.size());
+    }
+    // Moves classes registered into a shard (parallel / lazy registration) into this registry
+    void MergeShard(SnReflect& shard) {
+        for (auto& pair : shard.classes) {
+            TypeData& data = classes[pair.first];
+            data = std::move(pair.second);
+            IndexClass(data);
+            members[pair.first] = std::move(shard.members[pair.first]);
+            member_names[pair.first] = std::move(shard.member_names[pair.first]);
+        }
+        for (auto& pair : shard.meta_keys) {
+            InternMetaKey(pair.first, pair.second.c_str());
+        }
+    }
+    // Ensures class is registered before its tables are read, only does work in lazy mode
+    void Require(TypeHash class_hash) {
+        if (lazy) RequireLazy(class_hash);
+    }
+    void RequireLazy(TypeHash class_hash);
+    void FingerprintClass(TypeHash class_hash);
+    void RegisterLazyLocked(TypeHash class_hash);
+    // Creates (empty) entries for class in every table, so finalizing a class never inserts into a table
+    void PrepareClass(TypeHash class_hash) {
+        class_lookups[class_hash];
+        members[class_hash];
+        member_names[class_hash];
+        member_info[class_hash];
+        member_paths[class_hash];
+        copy_plans[class_hash];
+        compare_plans[class_hash];
+    }
+    void Finalize() {
+        // Registration is complete, no more members will be added
+        for (auto& pair : classes) {
+            PrepareClass(pair.first);
+        }
+        for (auto& pair : classes) {
+            FinalizeClass(pair.first);
+        }
+        frozen = true;
+    }
+    // Remembers name of string meta data key, keys are stored by hash only
+    void InternMetaKey(size_t key, const char* name) {
+        std::lock_guard<std::mutex> lock(meta_key_mutex);
+        std::string& interned = meta_keys[key];
+        assert((interned.empty() || interned == name) && "Meta data key hash collision, two keys hash to the same value!");
+        if (interned.empty()) interned = name;
+    }
+    void FinalizeClass(TypeHash class_hash) {
+        const TypeData& class_data = classes.find(class_hash)->second;
+        std::vector<TypeData>& class_members = members.find(class_hash)->second;
+        class_members.shrink_to_fit();
+
+        // Build compact hot member array in the arena, names point at the registration literals (no copies)
+        MemberInfo* infos = arena.AllocateArray<MemberInfo>(class_members.size());
+        for (size_t i = 0; i < class_members.size(); ++i) {
+            const TypeData& member = class_members[i];
+            infos[i].type_hash =    member.type_hash;
+            infos[i].size =         member.size;
+            infos[i].name =         (member.name_literal != nullptr) ? member.name_literal : arena.Intern(member.name.c_str(), member.name.length());
+            infos[i].offset =       member.offset;
+            infos[i].index =        member.index;
+            infos[i].thunks =       member.thunks;
+            infos[i].flags =        member.flags;
+            infos[i].descriptor =   member.descriptor;
+        }
+        MemberInfoRange& info_range = member_info.find(class_hash)->second;
+        info_range.first = infos;
+        info_range.last =  infos + class_members.size();
+
+        // Flatten member paths, members that are registered classes add "member.sub_member" entries
+        std::unordered_map<size_t, MemberInfo>& paths = member_paths.find(class_hash)->second;
+        paths.clear();
+        AddMemberPaths(paths, class_hash, std::string(), 0, -1);
+
+        // Build copy plan, trivially copyable classes are copied whole
+        CopyPlan& copy_plan = copy_plans.find(class_hash)->second;
+        copy_plan = CopyPlan();
+        std::vector<CopyOp> copy_ops { };
+        if (class_data.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+            CopyOp op { };
+            op.size = static_cast<int>(class_data.size);
+            copy_ops.push_back(op);
+        } else {
+            for (const TypeData& member : class_members) {
+                if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+                    // Extend previous memcpy run when this member directly follows it
+                    if (!copy_ops.empty() && copy_ops.back().copy == nullptr &&
+                        copy_ops.back().offset + copy_ops.back().size == member.offset) {
+                        copy_ops.back().size += static_cast<int>(member.size);
+                        continue;
+                    }
+                    CopyOp op { };
+                    op.offset = member.offset;
+                    op.size = static_cast<int>(member.size);
+                    copy_ops.push_back(op);
+                } else if (member.thunks != nullptr && member.thunks->copy != nullptr) {
+                    CopyOp op { };
+                    op.offset = member.offset;
+                    op.size = static_cast<int>(member.size);
+                    op.copy = member.thunks->copy;
+                    copy_ops.push_back(op);
+                } else {
+                    copy_plan.complete = false;
+                }
+            }
+        }
+        copy_plan.ops = ArenaCopy(copy_ops);
+
+        // Build compare plan, adjacent bitwise comparable members become one memcmp run
+        ComparePlan& compare_plan = compare_plans.find(class_hash)->second;
+        std::vector<CompareOp> compare_ops { };
+        AddCompareOps(compare_ops, class_hash, 0, -1);
+        compare_plan.ops = ArenaCopy(compare_ops);
+        FingerprintClass(class_hash);
+    }
+    // Adds compare steps for members of class_hash (at base_offset inside the outer class). Only bitwise comparable members
+    // are memcmp'd (other trivially copyable types may hold padding), members without operator== that are registered
+    // classes are compared member by member (steps keep the outer member index), anything else is not comparable.
+    void AddCompareOps(std::vector<CompareOp>& ops, TypeHash class_hash, int base_offset, int root_index) {
+        if (lazy && root_index >= 0) RegisterLazyLocked(class_hash);
+        auto it = members.find(class_hash);
+        if (it == members.end()) return;
+        bool last_run = false;                                                      // True if ops.back() is a memcmp run of this class
+        for (const TypeData& member : it->second) {
+            CompareOp op { };
+            op.offset =         base_offset + member.offset;
+            op.size =           static_cast<int>(member.size);
+            op.first_member =   (root_index < 0) ? member.index : root_index;
+            op.member_count =   1;
+            if (member.flags & TYPE_FLAG_BITWISE_COMPARABLE) {
+                if (last_run && ops.back().offset + ops.back().size == op.offset) {
+                    ops.back().size += op.size;
+                    if (root_index < 0) ops.back().member_count++;
+                    continue;
+                }
+                ops.push_back(op);
+                last_run = true;
+                continue;
+            }
+            last_run = false;
+            if (member.thunks != nullptr && member.thunks->equal != nullptr) {
+                op.equal = member.thunks->equal;
+                op.hash = member.thunks->hash;
+            } else if (member.type_hash != class_hash && classes.find(member.type_hash) != classes.end()) {
+                AddCompareOps(ops, member.type_hash, op.offset, op.first_member);
+                continue;
+            } else {
+                op.comparable = false;
+            }
+            ops.push_back(op);
+        }
+    }
+    // Adds paths of members of class_hash (at base_offset inside the outer class) under prefix, recurses into members
+    // that are registered classes. In lazy mode nested classes are registered first (lazy_mutex is already held).
+    void AddMemberPaths(std::unordered_map<size_t, MemberInfo>& paths, TypeHash class_hash, const std::string& prefix, int base_offset, int root_index) {
+        if (lazy && !prefix.empty()) RegisterLazyLocked(class_hash);
+        auto it = members.find(class_hash);
+        if (it == members.end()) return;
+        for (const TypeData& member : it->second) {
+            std::string path = prefix.empty() ? member.name : (prefix + "." + member.name);
+            MemberInfo info { };
+            info.type_hash =    member.type_hash;
+            info.size =         member.size;
+            info.name =         (prefix.empty() && member.name_literal != nullptr) ? member.name_literal : arena.Intern(path.c_str(), path.length());
+            info.offset =       base_offset + member.offset;
+            info.index =        (root_index < 0) ? member.index : root_index;
+            info.thunks =       member.thunks;
+            info.flags =        member.flags;
+            info.descriptor =   member.descriptor;
+            MemberInfo& added = paths.insert(std::make_pair(HashString(path.c_str()), info)).first->second;
+            assert(path == added.name && "Member path hash collision, two member paths of class hash to the same value!");
+            (void)added;
+            if (member.type_hash != class_hash && classes.find(member.type_hash) != classes.end()) {
+                AddMemberPaths(paths, member.type_hash, path, info.offset, info.index);
+            }
+        }
+    }
+    // Copies finished table into the arena
+    template <typename T>
+    ReflectRange<const T> ArenaCopy(const std::vector<T>& items) {
+        ReflectRange<const T> range { };
+        if (items.empty()) return range;
+        T* copy = arena.AllocateArray<T>(items.size());
+        std::copy(items.begin(), items.end(), copy);
+        range.first = copy;
+        range.last =  copy + items.size();
+        return range;
     }
 };
 
@@ -261,76 +926,607 @@ public:
 //##    Global Variable Declarations
 //############################
 extern std::shared_ptr<SnReflect>   g_reflect;                                      // Meta data singleton
-extern Functions                    g_register_list;                                // Keeps list of registration functions
+extern RegisterList                 g_register_list;                                // Keeps list of registration functions
+extern EnumRegisterList             g_enum_register_list;                           // Keeps list of enum registration functions
 
 //####################################################################################
 //##    General Functions
 //############################
-void            InitializeReflection();                                             // Creates SnReflect instance and registers classes and member variables
+void            InitializeReflection(Reflect_Init mode = REFLECT_INIT_EAGER, int thread_count = 0);    // Creates SnReflect instance and registers classes and member variables
+SnReflect*      RegistrationTarget();                                               // Registry that RegisterClass() / RegisterMember() write to on this thread
+uint64_t        ReflectionGeneration();                                             // Generation of current registry, 0 before InitializeReflection()
 void            CreateTitle(std::string& name);                                     // Create nice display name from class / member variable names
-void            RegisterClass(TypeData class_data);                                 // Update class TypeData
-void            RegisterMember(TypeData class_data, TypeData member_data);          // Update member TypeData
+void            RegisterClass(const TypeData& class_data);                          // Update class TypeData
+void            RegisterMember(const TypeData& class_data, const TypeData& member_data);    // Update member TypeData
 
 // TypeHash helper function
 template <typename T>
-TypeHash        TypeHashID() { return typeid(T).hash_code(); }
+TypeHash        TypeHashID() { static const TypeHash hash = typeid(T).hash_code(); return hash; }      // Cached, hash_code() hashes the type name on every call
+
+// Meta data, after InitializeReflection() the registry is frozen (safe for lock free reads from any thread) and
+// SetMetaData() copies the owner's sorted list, updates the copy and publishes it as the owner's MetaSnapshot (writers
+// are serialized, GetMetaData() reads the published list without locking)
+//      Replaced lists are kept so concurrent readers and returned references stay valid, call ReclaimMetaData() at a
+//      quiescent point (no other thread inside Get / SetMetaData(), no references from earlier GetMetaData() /
+//      GetMetaValue() calls still in use, e.g. between frames) to release them, later writes reuse the released lists
+//      Getters return a reference to the stored value (empty string when missing), string keys are looked up by
+//      hash so hot call sites can precompute the key with a constexpr NameHash:
+//          constexpr NameHash k_icon { "icon" };
+//          const std::string& icon = GetMetaData(type_data, k_icon);
+//      Values may be strings, bool, integers / enums, float / double, MetaRange or function pointers, read typed values
+//      back with GetMetaData<T>() (numbers convert between each other, strings are never parsed):
+//          bool hidden = GetMetaData<bool>(type_data, META_DATA_HIDDEN);
+void                SetMetaData(TypeData& type_data, int key, const MetaValue& data);
+void                SetMetaData(TypeData& type_data, const char* key, const MetaValue& data);
+void                SetMetaData(TypeData& type_data, const std::string& key, const MetaValue& data);
+const std::string&  GetMetaData(const TypeData& type_data, int key);
+const std::string&  GetMetaData(const TypeData& type_data, const char* key);
+const std::string&  GetMetaData(const TypeData& type_data, const std::string& key);
+const std::string&  GetMetaData(const TypeData& type_data, NameHash key);
+const MetaValue&    GetMetaValue(const TypeData& type_data, int key);
+const MetaValue&    GetMetaValue(const TypeData& type_data, const char* key);
+const MetaValue&    GetMetaValue(const TypeData& type_data, const std::string& key);
+const MetaValue&    GetMetaValue(const TypeData& type_data, NameHash key);
+const std::string&  MetaKeyName(size_t key_hash);                                  // Name of interned string meta data key
+void                ReclaimMetaData();                                              // Releases meta data lists replaced by SetMetaData(), see above
+template <typename T, typename Key>
+T                   GetMetaData(const TypeData& type_data, Key key, T fallback = T()) { return MetaValueAs(GetMetaValue(type_data, key), fallback); }
+
+//####################################################################################
+//##    Member Thunks
+//##        Type erased member operations, one static MemberThunks table per member type
+//############################
+// Detection of supported operations (std::vector forwards to its element type, as its operators are not SFINAE friendly)
+template <typename T>
+struct ThunkTraits {
+    template <typename U> static auto TestEqual(int) -> decltype(std::declval<const U&>() == std::declval<const U&>(), std::true_type());
+    template <typename U> static std::false_type TestEqual(...);
+    template <typename U> static auto TestOut(int) -> decltype(std::declval<std::ostream&>() << std::declval<const U&>(), std::true_type());
+    template <typename U> static std::false_type TestOut(...);
+    template <typename U> static auto TestIn(int) -> decltype(std::declval<std::istream&>() >> std::declval<U&>(), std::true_type());
+    template <typename U> static std::false_type TestIn(...);
+    template <typename U> static auto TestHash(int) -> decltype(std::hash<U>()(std::declval<const U&>()), std::true_type());
+    template <typename U> static std::false_type TestHash(...);
+    static constexpr bool copy =        std::is_copy_assignable<T>::value;
+    static constexpr bool move =        std::is_move_assignable<T>::value;
+    static constexpr bool equal =       decltype(TestEqual<T>(0))::value;
+    static constexpr bool to_string =   decltype(TestOut<T>(0))::value || std::is_enum<T>::value;
+    static constexpr bool from_string = decltype(TestIn<T>(0))::value || std::is_enum<T>::value;
+    static constexpr bool hash =        decltype(TestHash<T>(0))::value;
+};
+template <typename T, typename Alloc>
+struct ThunkTraits<std::vector<T, Alloc>> {
+    static constexpr bool copy =        ThunkTraits<T>::copy;
+    static constexpr bool move =        true;
+    static constexpr bool equal =       ThunkTraits<T>::equal;
+    static constexpr bool to_string =   ThunkTraits<T>::to_string;
+    static constexpr bool from_string = ThunkTraits<T>::from_string;
+    static constexpr bool hash =        ThunkTraits<T>::hash;
+};
+template <typename T, size_t N>
+struct ThunkTraits<T[N]> {
+    static constexpr bool copy =        false;
+    static constexpr bool move =        false;
+    static constexpr bool equal =       ThunkTraits<T>::equal;                      // Compared / hashed element by element
+    static constexpr bool to_string =   false;
+    static constexpr bool from_string = false;
+    static constexpr bool hash =        ThunkTraits<T>::hash;
+};
+
+// Enum value <-> name of reflected enums (numbers for unnamed values / enums that are not reflected)
+void EnumWrite(std::ostream& out, TypeHash enum_hash, int64_t value);
+bool EnumRead(const std::string& text, TypeHash enum_hash, int64_t& value);
+
+// Value <-> string conversion used by thunks, std::vector elements are seperated by ", "
+template <typename T>
+void ThunkWriteValue(std::ostream& out, const T& value, std::false_type /* enum */) { out << value; }
+template <typename T>
+void ThunkWriteValue(std::ostream& out, const T& value, std::true_type /* enum */) { EnumWrite(out, TypeHashID<T>(), static_cast<int64_t>(value)); }
+template <typename T>
+void ThunkWrite(std::ostream& out, const T& value) { ThunkWriteValue(out, value, std::integral_constant<bool, std::is_enum<T>::value>()); }
+inline void ThunkWrite(std::ostream& out, const bool& value) { out << (value ? "true" : "false"); }
+template <typename T, typename Alloc>
+void ThunkWrite(std::ostream& out, const std::vector<T, Alloc>& value) {
+    for (size_t i = 0; i < value.size(); ++i) {
+        if (i > 0) out << ", ";
+        ThunkWrite(out, value[i]);
+    }
+}
+template <typename T>
+bool ThunkReadValue(const std::string& text, T& value, std::false_type /* enum */) {
+    std::istringstream in(text);
+    in >> value;
+    return !in.fail();
+}
+template <typename T>
+bool ThunkReadValue(const std::string& text, T& value, std::true_type /* enum */) {
+    int64_t number = 0;
+    if (!EnumRead(text, TypeHashID<T>(), number)) return false;
+    value = static_cast<T>(number);
+    return true;
+}
+template <typename T>
+bool ThunkRead(const std::string& text, T& value) { return ThunkReadValue(text, value, std::integral_constant<bool, std::is_enum<T>::value>()); }
+inline bool ThunkRead(const std::string& text, std::string& value) { value = text; return true; }
+inline bool ThunkRead(const std::string& text, bool& value) {
+    if (text == "true" || text == "1")  { value = true;  return true; }
+    if (text == "false" || text == "0") { value = false; return true; }
+    return false;
+}
+template <typename T, typename Alloc>
+bool ThunkRead(const std::string& text, std::vector<T, Alloc>& value) {
+    std::vector<T, Alloc> result { };
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find(',', start);
+        if (end == std::string::npos) end = text.size();
+        size_t first = text.find_first_not_of(' ', start);
+        if (first != std::string::npos && first < end) {
+            T element { };
+            if (!ThunkRead(text.substr(first, end - first), element)) return false;
+            result.push_back(element);
+        }
+        start = end + 1;
+    }
+    value.swap(result);
+    return true;
+}
+
+// Equality and hashing used by thunks (arrays element by element)
+template <typename T>
+bool ThunkEqualValue(const T& a, const T& b) { return a == b; }
+template <typename T, size_t N>
+bool ThunkEqualValue(const T (&a)[N], const T (&b)[N]) {
+    for (size_t i = 0; i < N; ++i) {
+        if (!ThunkEqualValue(a[i], b[i])) return false;
+    }
+    return true;
+}
+template <typename T>
+size_t ThunkHashValue(const T& value) { return std::hash<T>()(value); }
+template <typename T, typename Alloc>
+size_t ThunkHashValue(const std::vector<T, Alloc>& value) {
+    size_t hash = value.size();
+    for (const T& element : value) {
+        hash ^= ThunkHashValue(element) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+template <typename T, size_t N>
+size_t ThunkHashValue(const T (&value)[N]) {
+    size_t hash = N;
+    for (size_t i = 0; i < N; ++i) {
+        hash ^= ThunkHashValue(value[i]) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+// Destruction used by thunks (arrays are destroyed element by element)
+template <typename T>
+void ThunkDestroyValue(T& value) { value.~T(); }
+template <typename T, size_t N>
+void ThunkDestroyValue(T (&value)[N]) { for (size_t i = 0; i < N; ++i) ThunkDestroyValue(value[i]); }
+
+// Individual thunks, the bool parameter selects a nullptr when the operation is not supported
+template <typename T, bool Enabled = ThunkTraits<T>::copy>
+struct ThunkCopy        { static void (*Get())(void*, const void*) { return [](void* dst, const void* src) { *static_cast<T*>(dst) = *static_cast<const T*>(src); }; } };
+template <typename T>
+struct ThunkCopy<T, false>          { static void (*Get())(void*, const void*) { return nullptr; } };
+template <typename T, bool Enabled = ThunkTraits<T>::move>
+struct ThunkMove        { static void (*Get())(void*, void*) { return [](void* dst, void* src) { *static_cast<T*>(dst) = std::move(*static_cast<T*>(src)); }; } };
+template <typename T>
+struct ThunkMove<T, false>          { static void (*Get())(void*, void*) { return nullptr; } };
+template <typename T, bool Enabled = std::is_default_constructible<T>::value>
+struct ThunkConstruct   { static void (*Get())(void*) { return [](void* member) { new (member) T(); }; } };
+template <typename T>
+struct ThunkConstruct<T, false>     { static void (*Get())(void*) { return nullptr; } };
+template <typename T, bool Enabled = ThunkTraits<T>::equal>
+struct ThunkEqual       { static bool (*Get())(const void*, const void*) { return [](const void* a, const void* b) -> bool { return ThunkEqualValue(*static_cast<const T*>(a), *static_cast<const T*>(b)); }; } };
+template <typename T>
+struct ThunkEqual<T, false>         { static bool (*Get())(const void*, const void*) { return nullptr; } };
+template <typename T, bool Enabled = ThunkTraits<T>::to_string>
+struct ThunkToString    { static std::string (*Get())(const void*) { return [](const void* member) { std::ostringstream out; out.precision(17); ThunkWrite(out, *static_cast<const T*>(member)); return out.str(); }; } };
+template <typename T>
+struct ThunkToString<T, false>      { static std::string (*Get())(const void*) { return nullptr; } };
+template <typename T, bool Enabled = ThunkTraits<T>::from_string>
+struct ThunkFromString  { static bool (*Get())(void*, const std::string&) { return [](void* member, const std::string& text) { return ThunkRead(text, *static_cast<T*>(member)); }; } };
+template <typename T>
+struct ThunkFromString<T, false>    { static bool (*Get())(void*, const std::string&) { return nullptr; } };
+template <typename T, bool Enabled = ThunkTraits<T>::hash>
+struct ThunkHash        { static size_t (*Get())(const void*) { return [](const void* member) { return ThunkHashValue(*static_cast<const T*>(member)); }; } };
+template <typename T>
+struct ThunkHash<T, false>          { static size_t (*Get())(const void*) { return nullptr; } };
+
+// Binary encoding used by thunks: trivially copyable types are raw bytes, std::string / std::vector are a uint32
+// count followed by their contents, other types fall back to their string conversion
+template <typename T>
+struct BinaryTraits {
+    static constexpr bool raw =         std::is_trivially_copyable<T>::value;
+    static constexpr bool supported =   raw || (ThunkTraits<T>::to_string && ThunkTraits<T>::from_string);
+};
+template <>
+struct BinaryTraits<std::string> {
+    static constexpr bool raw =         false;
+    static constexpr bool supported =   true;
+};
+template <typename T, typename Alloc>
+struct BinaryTraits<std::vector<T, Alloc>> {
+    static constexpr bool raw =         false;
+    static constexpr bool supported =   BinaryTraits<T>::supported;
+    static constexpr bool raw_elements = BinaryTraits<T>::raw && !std::is_same<T, bool>::value;     // std::vector<bool> has no data()
+};
+template <typename T, size_t N>
+struct BinaryTraits<T[N]> {
+    static constexpr bool raw =         std::is_trivially_copyable<T>::value;
+    static constexpr bool supported =   raw;
+};
+inline void BinaryAppend(std::vector<char>& out, const void* data, size_t size) {
+    out.insert(out.end(), (const char*)(data), (const char*)(data) + size);
+}
+inline bool BinaryTake(const char*& cursor, const char* end, void* data, size_t size) {
+    if (static_cast<size_t>(end - cursor) < size) return false;
+    memcpy(data, cursor, size);
+    cursor += size;
+    return true;
+}
+template <typename T>
+void BinaryWriteValue(std::vector<char>& out, const T& value, std::true_type /* raw */) {
+    BinaryAppend(out, &value, sizeof(T));
+}
+template <typename T>
+void BinaryWriteValue(std::vector<char>& out, const T& value, std::false_type /* raw */) {
+    std::ostringstream text; text.precision(17);
+    ThunkWrite(text, value);
+    const std::string str = text.str();
+    uint32_t length = static_cast<uint32_t>(str.size());
+    BinaryAppend(out, &length, sizeof(length));
+    BinaryAppend(out, str.data(), str.size());
+}
+template <typename T>
+bool BinaryReadValue(const char*& cursor, const char* end, T& value, std::true_type /* raw */) {
+    return BinaryTake(cursor, end, &value, sizeof(T));
+}
+template <typename T>
+bool BinaryReadValue(const char*& cursor, const char* end, T& value, std::false_type /* raw */) {
+    uint32_t length = 0;
+    if (!BinaryTake(cursor, end, &length, sizeof(length)) || static_cast<size_t>(end - cursor) < length) return false;
+    bool result = ThunkRead(std::string(cursor, length), value);
+    cursor += length;
+    return result;
+}
+template <typename T>
+void BinaryWrite(std::vector<char>& out, const T& value) {
+    BinaryWriteValue(out, value, std::integral_constant<bool, BinaryTraits<T>::raw>());
+}
+template <typename T>
+bool BinaryRead(const char*& cursor, const char* end, T& value) {
+    return BinaryReadValue(cursor, end, value, std::integral_constant<bool, BinaryTraits<T>::raw>());
+}
+inline void BinaryWrite(std::vector<char>& out, const std::string& value) {
+    uint32_t length = static_cast<uint32_t>(value.size());
+    BinaryAppend(out, &length, sizeof(length));
+    BinaryAppend(out, value.data(), value.size());
+}
+inline bool BinaryRead(const char*& cursor, const char* end, std::string& value) {
+    uint32_t length = 0;
+    if (!BinaryTake(cursor, end, &length, sizeof(length)) || static_cast<size_t>(end - cursor) < length) return false;
+    value.assign(cursor, length);
+    cursor += length;
+    return true;
+}
+template <typename T, typename Alloc>
+void BinaryWriteElements(std::vector<char>& out, const std::vector<T, Alloc>& value, std::true_type /* raw */) {
+    if (!value.empty()) BinaryAppend(out, value.data(), value.size() * sizeof(T));
+}
+template <typename T, typename Alloc>
+void BinaryWriteElements(std::vector<char>& out, const std::vector<T, Alloc>& value, std::false_type /* raw */) {
+    for (const T& element : value) BinaryWrite(out, element);
+}
+template <typename T, typename Alloc>
+bool BinaryReadElements(const char*& cursor, const char* end, std::vector<T, Alloc>& value, std::true_type /* raw */) {
+    return value.empty() || BinaryTake(cursor, end, value.data(), value.size() * sizeof(T));
+}
+template <typename T, typename Alloc>
+bool BinaryReadElements(const char*& cursor, const char* end, std::vector<T, Alloc>& value, std::false_type /* raw */) {
+    for (size_t i = 0; i < value.size(); ++i) {
+        T element { };
+        if (!BinaryRead(cursor, end, element)) return false;
+        value[i] = std::move(element);
+    }
+    return true;
+}
+template <typename T, typename Alloc>
+void BinaryWrite(std::vector<char>& out, const std::vector<T, Alloc>& value) {
+    uint32_t count = static_cast<uint32_t>(value.size());
+    BinaryAppend(out, &count, sizeof(count));
+    BinaryWriteElements(out, value, std::integral_constant<bool, BinaryTraits<std::vector<T, Alloc>>::raw_elements>());
+}
+template <typename T, typename Alloc>
+bool BinaryRead(const char*& cursor, const char* end, std::vector<T, Alloc>& value) {
+    uint32_t count = 0;
+    if (!BinaryTake(cursor, end, &count, sizeof(count))) return false;
+    // Reject counts that can't fit in the remaining bytes before allocating, non raw elements start with a uint32 length
+    const size_t min_element_size = BinaryTraits<T>::raw ? sizeof(T) : sizeof(uint32_t);
+    if (static_cast<size_t>(end - cursor) / min_element_size < count) return false;
+    value.resize(count);
+    return BinaryReadElements(cursor, end, value, std::integral_constant<bool, BinaryTraits<std::vector<T, Alloc>>::raw_elements>());
+}
+template <typename T, bool Enabled = BinaryTraits<T>::supported>
+struct ThunkBinary {
+    static void (*Write())(std::vector<char>&, const void*) { return [](std::vector<char>& out, const void* member) { BinaryWrite(out, *static_cast<const T*>(member)); }; }
+    static bool (*Read())(const char*, size_t, void*) { return [](const char* data, size_t length, void* member) { return BinaryRead(data, data + length, *static_cast<T*>(member)); }; }
+};
+template <typename T>
+struct ThunkBinary<T, false> {
+    static void (*Write())(std::vector<char>&, const void*) { return nullptr; }
+    static bool (*Read())(const char*, size_t, void*) { return nullptr; }
+};
+
+// Sequence container traits, specialize for other containers (container = true, Element, contiguous, Size / Data /
+// At / Resize) to make their members iterable through MemberElements() / ContainerThunks
+template <typename T>
+struct ContainerTraits {
+    static constexpr bool container =   false;
+};
+template <typename T, typename Alloc>
+struct ContainerTraits<std::vector<T, Alloc>> {
+    using Element = T;
+    static constexpr bool container =   true;
+    static constexpr bool contiguous =  true;
+    static size_t   Size(const std::vector<T, Alloc>& value)                { return value.size(); }
+    static void*    Data(std::vector<T, Alloc>& value)                      { return value.data(); }
+    static void*    At(std::vector<T, Alloc>& value, size_t index)          { return &value[index]; }
+    static bool     Resize(std::vector<T, Alloc>& value, size_t count)      { value.resize(count); return true; }
+};
+template <typename Alloc>
+struct ContainerTraits<std::vector<bool, Alloc>> {                                  // Packed bits, elements are not addressable
+    using Element = bool;
+    static constexpr bool container =   true;
+    static constexpr bool contiguous =  false;
+    static size_t   Size(const std::vector<bool, Alloc>& value)             { return value.size(); }
+    static void*    Data(std::vector<bool, Alloc>&)                         { return nullptr; }
+    static void*    At(std::vector<bool, Alloc>&, size_t)                   { return nullptr; }
+    static bool     Resize(std::vector<bool, Alloc>& value, size_t count)   { value.resize(count); return true; }
+};
+template <typename T, size_t N>
+struct ContainerTraits<std::array<T, N>> {
+    using Element = T;
+    static constexpr bool container =   true;
+    static constexpr bool contiguous =  true;
+    static size_t   Size(const std::array<T, N>&)                           { return N; }
+    static void*    Data(std::array<T, N>& value)                           { return value.data(); }
+    static void*    At(std::array<T, N>& value, size_t index)               { return &value[index]; }
+    static bool     Resize(std::array<T, N>&, size_t count)                 { return count == N; }
+};
+template <typename T, size_t N>
+struct ContainerTraits<T[N]> {
+    using Element = T;
+    static constexpr bool container =   true;
+    static constexpr bool contiguous =  true;
+    static size_t   Size(const T (&)[N])                                    { return N; }
+    static void*    Data(T (&value)[N])                                     { return &value[0]; }
+    static void*    At(T (&value)[N], size_t index)                         { return &value[index]; }
+    static bool     Resize(T (&)[N], size_t count)                          { return count == N; }
+};
+template <typename MemberType>
+const MemberThunks* GetMemberThunks();
+template <typename T, bool Enabled = ContainerTraits<T>::container>
+struct ThunkContainer {
+    static const ContainerThunks* Get() {
+        using Traits = ContainerTraits<T>;
+        using Element = typename Traits::Element;
+        static const ContainerThunks thunks {
+            TypeHashID<Element>(),
+            sizeof(Element),
+            GetMemberThunks<Element>(),
+            Traits::contiguous,
+            [](const void* container) { return Traits::Size(*static_cast<const T*>(container)); },
+            [](void* container) { return Traits::Data(*static_cast<T*>(container)); },
+            [](void* container, size_t index) { return Traits::At(*static_cast<T*>(container), index); },
+            [](void* container, size_t count) { return Traits::Resize(*static_cast<T*>(container), count); },
+        };
+        return &thunks;
+    }
+};
+template <typename T>
+struct ThunkContainer<T, false>     { static const ContainerThunks* Get() { return nullptr; } };
 
-// Meta data
-void            SetMetaData(TypeData& type_data, int key, std::string data);
-void            SetMetaData(TypeData& type_data, std::string key, std::string data);
-std::string     GetMetaData(TypeData& type_data, int key);
-std::string     GetMetaData(TypeData& type_data, std::string key);
+// Returns static table of type erased operations for member type
+template <typename MemberType>
+const MemberThunks* GetMemberThunks() {
+    static const MemberThunks thunks {
+        ThunkCopy<MemberType>::Get(),
+        ThunkMove<MemberType>::Get(),
+        ThunkEqual<MemberType>::Get(),
+        ThunkConstruct<MemberType>::Get(),
+        [](void* member) { ThunkDestroyValue(*static_cast<MemberType*>(member)); },
+        ThunkToString<MemberType>::Get(),
+        ThunkFromString<MemberType>::Get(),
+        ThunkHash<MemberType>::Get(),
+        ThunkBinary<MemberType>::Write(),
+        ThunkBinary<MemberType>::Read(),
+        ThunkContainer<MemberType>::Get(),
+    };
+    return &thunks;
+}
+// Returns static table of class lifetime operations (construct / destroy only). Value operations are left out, class
+// copy / compare goes through member plans, and a class's implicit copy can be declared without being instantiable
+// (e.g. a std::vector<std::unique_ptr<T>> member).
+template <typename ClassType>
+const MemberThunks* GetClassThunks() {
+    static const MemberThunks thunks {
+        nullptr,
+        nullptr,
+        nullptr,
+        ThunkConstruct<ClassType>::Get(),
+        [](void* object) { ThunkDestroyValue(*static_cast<ClassType*>(object)); },
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+    };
+    return &thunks;
+}
 
 //####################################################################################
 //##    Class / Member Registration
 //############################
+// Type_Flags of a class / member type
+template <typename T>
+int TypeFlags() {
+    using Element = typename std::remove_all_extents<T>::type;
+    // Floating point is left out, memcmp would treat -0.0 / 0.0 as different and equal NaNs as equal (unlike operator==)
+    bool bitwise = std::is_integral<Element>::value || std::is_enum<Element>::value || std::is_pointer<Element>::value;
+    return (std::is_trivially_copyable<T>::value ? TYPE_FLAG_TRIVIALLY_COPYABLE : TYPE_FLAG_NONE) |
+           (bitwise ? TYPE_FLAG_BITWISE_COMPARABLE : TYPE_FLAG_NONE) |
+           (ContainerTraits<T>::container ? TYPE_FLAG_CONTAINER : TYPE_FLAG_NONE) |
+           (std::is_enum<T>::value ? TYPE_FLAG_ENUM : TYPE_FLAG_NONE);
+}
+
+// Stable (cross build / process) descriptor of a type's stored representation, 0 if unknown. Arithmetic types are
+// described by kind and size (enums by their underlying type), classes by REFLECT_TYPE_ID, std::string /
+// std::vector / arrays by their element type. Stored in binary schemas so retyped members are never copied bitwise.
+enum Type_Kind {
+    TYPE_KIND_UNKNOWN =                 0,
+    TYPE_KIND_BOOL =                    1,                                          // bool
+    TYPE_KIND_SIGNED =                  2,                                          // Signed integer
+    TYPE_KIND_UNSIGNED =                3,                                          // Unsigned integer
+    TYPE_KIND_FLOAT =                   4,                                          // Floating point
+    TYPE_KIND_POINTER =                 5,                                          // Pointer (value only meaningful within a process)
+    TYPE_KIND_STRING =                  6,                                          // std::string
+    TYPE_KIND_VECTOR =                  7,                                          // std::vector of element type
+    TYPE_KIND_ARRAY =                   8,                                          // Fixed size array / std::array of element type
+};
+inline uint64_t TypeDescriptorOf(uint64_t kind, uint64_t size, uint64_t element = 0) {
+    return ((kind << 56) | size) ^ (element * 0x100000001b3ULL);
+}
+template <typename T, typename Enable = void>
+struct TypeDescriptor {
+    static uint64_t Get() { return ReflectTypeID<T>::declared ? static_cast<uint64_t>(ReflectTypeID<T>::value) : 0; }
+};
+template <typename T>
+struct TypeDescriptor<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+    static uint64_t Get() {
+        uint64_t kind = std::is_same<T, bool>::value ? TYPE_KIND_BOOL : std::is_floating_point<T>::value ? TYPE_KIND_FLOAT :
+                        std::is_signed<T>::value ? TYPE_KIND_SIGNED : TYPE_KIND_UNSIGNED;
+        return TypeDescriptorOf(kind, sizeof(T));
+    }
+};
+template <typename T>
+struct TypeDescriptor<T, typename std::enable_if<std::is_enum<T>::value>::type> {
+    static uint64_t Get() { return TypeDescriptor<typename std::underlying_type<T>::type>::Get(); }
+};
+template <typename T>
+struct TypeDescriptor<T*>                       { static uint64_t Get() { return TypeDescriptorOf(TYPE_KIND_POINTER, sizeof(T*)); } };
+template <>
+struct TypeDescriptor<std::string>              { static uint64_t Get() { return TypeDescriptorOf(TYPE_KIND_STRING, 0); } };
+template <typename T, typename Alloc>
+struct TypeDescriptor<std::vector<T, Alloc>>    { static uint64_t Get() { return TypeDescriptorOf(TYPE_KIND_VECTOR, 0, TypeDescriptor<T>::Get()); } };
+template <typename T, size_t N>
+struct TypeDescriptor<T[N]>                     { static uint64_t Get() { return TypeDescriptorOf(TYPE_KIND_ARRAY, N, TypeDescriptor<T>::Get()); } };
+template <typename T, size_t N>
+struct TypeDescriptor<std::array<T, N>>         { static uint64_t Get() { return TypeDescriptorOf(TYPE_KIND_ARRAY, N, TypeDescriptor<T>::Get()); } };
+
 // Template wrapper to register type information with SnReflect from header files
 template <typename T> void InitiateClass() { };
 
 // Call this to register class / struct type with reflection / meta data system
 template <typename ClassType>
-void RegisterClass(TypeData class_data) {
+void RegisterClass(TypeData& class_data) {
     assert(std::is_standard_layout<ClassType>() && "Class is not standard layout!!");
-	g_reflect->AddClass(class_data);
+    class_data.size = sizeof(ClassType);
+    class_data.alignment = alignof(ClassType);
+    class_data.thunks = GetClassThunks<ClassType>();
+    class_data.flags = TypeFlags<ClassType>();
+    class_data.descriptor = TypeDescriptor<ClassType>::Get();
+	RegistrationTarget()->AddClass(class_data);
+}
+
+// Captures type erased member operations and type flags of member variable into member TypeData
+template <typename MemberType>
+void InitiateMember(TypeData& member_data) {
+    member_data.thunks = GetMemberThunks<MemberType>();
+    member_data.alignment = alignof(MemberType);
+    member_data.flags = TypeFlags<MemberType>();
+    member_data.descriptor = TypeDescriptor<MemberType>::Get();
 }
 
-// Call this to register member variable with reflection / meta data system
+// Template wrapper to register enum values with SnReflect from header files
+template <typename T> void InitiateEnum() { };
+template <typename T> struct EnumRegistration { static bool registered; };          // Defined by REFLECT_ENUM_END()
+
+// Call this to register enum with reflection system, builds value / name lookup tables
+void RegisterEnum(EnumData& enum_data);
+
+// Call this to register member variable with reflection / meta data system, captures type erased member operations
 template <typename MemberType>
-void RegisterMember(TypeData class_data, TypeData member_data) {
-	g_reflect->AddMember(class_data, member_data);
+void RegisterMember(const TypeData& class_data, TypeData& member_data) {
+    InitiateMember<MemberType>(member_data);
+	RegistrationTarget()->AddMember(class_data, member_data);
 }
 
 //####################################################################################
 //##    Reflection TypeData Fetching
 //############################
+// NOTES:
+//  All fetching functions are read only, a miss never inserts into the registry. The ClassData() / MemberData()
+//  functions return 'unknown_type' on a miss, the TryClassData() / TryMemberData() functions return nullptr.
+//
 // #################### Class Data Fetching ####################
+// Class TypeData fetching from passed in class TypeHash
+TypeData* TryClassData(TypeHash class_hash);
+TypeData& ClassData(TypeHash class_hash);
 // Class TypeData fetching by actual class type
 template<typename T>
+TypeData* TryClassData() {
+    return TryClassData(TypeHashID<T>());
+}
+template<typename T>
 TypeData& ClassData() {
-    TypeHash class_hash = typeid(T).hash_code();
-    if (g_reflect->classes.find(class_hash) != g_reflect->classes.end()) {
-        return g_reflect->classes[class_hash];
-    } else {
-        return unknown_type;
-    }
+    return ClassData(TypeHashID<T>());
 }
 // Class TypeData fetching from passed in class instance
 template<typename T>
 TypeData& ClassData(T& class_instance) {
     return ClassData<T>();
 }
-// Class TypeData fetching from passed in class TypeHash
-TypeData& ClassData(TypeHash class_hash);
 // Class TypeData fetching from passed in class name
-TypeData& ClassData(std::string class_name);
+TypeData* TryClassData(const std::string& class_name);
+TypeData* TryClassData(const char* class_name);
+TypeData* TryClassData(NameHash class_name);
+TypeData& ClassData(const std::string& class_name);
 TypeData& ClassData(const char* class_name);
+TypeData& ClassData(NameHash class_name);
+TypeData* TryClassDataByID(TypeID type_id);                                         // Class TypeData by stable type id
+TypeData& ClassDataByID(TypeID type_id);
 
 // #################### Member Data Fetching ####################
+// -------------------------    Range     -------------------------
+// Contiguous range of all member TypeData of class by class TypeHash, sorted by offset
+MemberRange Members(TypeHash class_hash);
+// Contiguous range of all member TypeData of class by class type
+template<typename T>
+MemberRange Members() {
+    return Members(TypeHashID<T>());
+}
+// Contiguous range of all member TypeData of class by class instance
+template<typename T>
+MemberRange Members(T& class_instance) {
+    return Members<T>();
+}
+
 // -------------------------    By Index  -------------------------
 // Member TypeData fetching by member variable index and class TypeHash
+TypeData* TryMemberData(TypeHash class_hash, int member_index);
 TypeData& MemberData(TypeHash class_hash, int member_index);
 // Member TypeData fetching by member variable index and class name
 template<typename T>
+TypeData* TryMemberData(int member_index) {
+    return TryMemberData(TypeHashID<T>(), member_index);
+}
+template<typename T>
 TypeData& MemberData(int member_index) {
     return MemberData(TypeHashID<T>(), member_index);
 }
@@ -342,21 +1538,155 @@ TypeData& MemberData(T& class_instance, int member_index) {
 
 // -------------------------    By Name  -------------------------
 // Member TypeData fetching by member variable Name and class TypeHash
-TypeData& MemberData(TypeHash class_hash, std::string member_name);
+TypeData* TryMemberData(TypeHash class_hash, const std::string& member_name);
+TypeData* TryMemberData(TypeHash class_hash, const char* member_name);
+TypeData* TryMemberData(TypeHash class_hash, NameHash member_name);
+TypeData& MemberData(TypeHash class_hash, const std::string& member_name);
+TypeData& MemberData(TypeHash class_hash, const char* member_name);
+TypeData& MemberData(TypeHash class_hash, NameHash member_name);
 // Member TypeData fetching by member variable Name and class name
 template<typename T>
-TypeData& MemberData(std::string member_name) {
+TypeData* TryMemberData(const std::string& member_name) {
+    return TryMemberData(TypeHashID<T>(), member_name);
+}
+template<typename T>
+TypeData* TryMemberData(const char* member_name) {
+    return TryMemberData(TypeHashID<T>(), member_name);
+}
+template<typename T>
+TypeData* TryMemberData(NameHash member_name) {
+    return TryMemberData(TypeHashID<T>(), member_name);
+}
+template<typename T>
+TypeData& MemberData(const std::string& member_name) {
+    return MemberData(TypeHashID<T>(), member_name);
+}
+template<typename T>
+TypeData& MemberData(const char* member_name) {
+    return MemberData(TypeHashID<T>(), member_name);
+}
+template<typename T>
+TypeData& MemberData(NameHash member_name) {
     return MemberData(TypeHashID<T>(), member_name);
 }
 // Member TypeData fetching by member variable name and class instance
 template<typename T>
-TypeData& MemberData(T& class_instance, std::string member_name) {
+TypeData& MemberData(T& class_instance, const std::string& member_name) {
+    return MemberData<T>(member_name);
+}
+template<typename T>
+TypeData& MemberData(T& class_instance, const char* member_name) {
+    return MemberData<T>(member_name);
+}
+template<typename T>
+TypeData& MemberData(T& class_instance, NameHash member_name) {
     return MemberData<T>(member_name);
 }
 
-// #################### Member Variable Fetching ####################
-// NOTES:
-//  Internal Casting
+// #################### Member Info Fetching ####################
+// MemberInfo is the compact (hot) version of member TypeData, use it in per object loops
+// Contiguous range of all member MemberInfo of class by class TypeHash, sorted by offset
+MemberInfoRange MemberInfos(TypeHash class_hash);
+template<typename T>
+MemberInfoRange MemberInfos() {
+    return MemberInfos(TypeHashID<T>());
+}
+template<typename T>
+MemberInfoRange MemberInfos(T& class_instance) {
+    return MemberInfos<T>();
+}
+// MemberInfo fetching by class TypeHash and member variable index / name / precomputed name hash
+const MemberInfo* TryMemberInfo(TypeHash class_hash, int member_index);
+const MemberInfo* TryMemberInfo(TypeHash class_hash, const char* member_name);
+const MemberInfo* TryMemberInfo(TypeHash class_hash, NameHash member_name);
+const MemberInfo& GetMemberInfo(TypeHash class_hash, int member_index);
+const MemberInfo& GetMemberInfo(TypeHash class_hash, const char* member_name);
+const MemberInfo& GetMemberInfo(TypeHash class_hash, NameHash member_name);
+// MemberInfo fetching by class type and member variable index / name / precomputed name hash
+template<typename T, typename Key>
+const MemberInfo& GetMemberInfo(Key member_key) {
+    return GetMemberInfo(TypeHashID<T>(), member_key);
+}
+// MemberInfo fetching by class instance and member variable index / name / precomputed name hash
+template<typename T, typename Key>
+const MemberInfo& GetMemberInfo(T& class_instance, Key member_key) {
+    return GetMemberInfo(TypeHashID<T>(), member_key);
+}
+
+// #################### Member Path Fetching ####################
+// Members whose type is a registered class are flattened at registration, "position.x" resolves with one hashed
+// lookup to a MemberInfo with the absolute offset of 'x' inside the outer class (index is of the top level member,
+// name is the full path). Top level member names are valid paths too.
+const MemberInfo* TryMemberPath(TypeHash class_hash, const char* member_path);
+const MemberInfo* TryMemberPath(TypeHash class_hash, NameHash member_path);
+const MemberInfo& MemberPath(TypeHash class_hash, const char* member_path);
+const MemberInfo& MemberPath(TypeHash class_hash, NameHash member_path);
+// MemberInfo fetching by class type and member path / precomputed path hash
+template<typename T, typename Key>
+const MemberInfo& MemberPath(Key member_path) {
+    return MemberPath(TypeHashID<T>(), member_path);
+}
+// MemberInfo fetching by class instance and member path / precomputed path hash
+template<typename T, typename Key>
+const MemberInfo& MemberPath(T& class_instance, Key member_path) {
+    return MemberPath(TypeHashID<T>(), member_path);
+}
+
+// #################### Enum Fetching ####################
+// Enums registered with REFLECT_ENUM(), enum typed members (TYPE_FLAG_ENUM) find theirs by member type_hash
+EnumData* TryEnumData(TypeHash enum_hash);
+const char* EnumToName(TypeHash enum_hash, int64_t value);                           // nullptr if value has no name
+bool EnumFromName(TypeHash enum_hash, const char* name, int64_t& value);              // false if name is not a value of enum
+template<typename T>
+EnumData* TryEnumData() {
+    return TryEnumData(TypeHashID<T>());
+}
+template<typename T>
+const char* EnumToName(T value) {
+    static_assert(std::is_enum<T>::value, "EnumToName() requires an enum type!");
+    return EnumToName(TypeHashID<T>(), static_cast<int64_t>(value));
+}
+template<typename T>
+bool EnumFromName(const char* name, T& value) {
+    static_assert(std::is_enum<T>::value, "EnumFromName() requires an enum type!");
+    int64_t number = 0;
+    if (!EnumFromName(TypeHashID<T>(), name, number)) return false;
+    value = static_cast<T>(number);
+    return true;
+}
+
+// #################### Lookup Statistics ####################
+// Compile the REGISTER_REFLECTION file with REFLECT_ENABLE_STATS defined to count lookups (compiles to nothing
+// otherwise, GetReflectionStats() then returns an empty snapshot). Registry layout does not depend on the define, so
+// other files may be compiled without it. Counters are atomic and safe to update from any thread.
+enum Stat_Api {
+    STAT_API_CLASS_DATA = 0,                                                        // ClassData() / TryClassData()
+    STAT_API_MEMBER_DATA,                                                           // MemberData() / TryMemberData()
+    STAT_API_MEMBER_INFO,                                                           // GetMemberInfo() / TryMemberInfo()
+    STAT_API_MEMBER_PATH,                                                           // MemberPath() / TryMemberPath()
+    STAT_API_COUNT,
+};
+enum Stat_Key {
+    STAT_KEY_HASH = 0,                                                              // By class TypeHash
+    STAT_KEY_NAME,                                                                  // By name (hashed at runtime)
+    STAT_KEY_NAME_HASH,                                                             // By precomputed NameHash
+    STAT_KEY_INDEX,                                                                 // By member index
+    STAT_KEY_ID,                                                                    // By stable TypeID
+    STAT_KEY_COUNT,
+};
+struct ReflectStats {
+    bool                enabled         { false };                                  // True when compiled with REFLECT_ENABLE_STATS
+    uint64_t            lookups[STAT_API_COUNT][STAT_KEY_COUNT] { };                // Lookups by api and key kind
+    uint64_t            misses[STAT_API_COUNT][STAT_KEY_COUNT] { };                 // Lookups that found nothing
+    uint64_t            unknown_returns { 0 };                                      // Times unknown_type / unknown_member was returned
+    std::vector<std::pair<TypeHash, uint64_t>> class_lookups { };                   // Lookups per class, most looked up first
+};
+ReflectStats GetReflectionStats();                                                  // Snapshot of counters
+void ResetReflectionStats();                                                        // Zeroes counters
+
+// #################### Member Variable Fetching ####################
+// NOTES:
+//  Internal Casting
 //      /* Casting from void*, not fully standardized across compilers? */
 //      SnVec3 rotation = *(SnVec3*)(class_ptr + member_data.offset);
 //  Memcpy
@@ -366,11 +1696,724 @@ TypeData& MemberData(T& class_instance, std::string member_name) {
 //      static constexpr auto offset_rotation = &Transform2D::rotation;
 //      SnVec3 rotation = ((&et)->*off_rot);
 template<typename ReturnType>
-ReturnType& ClassMember(void* class_ptr, TypeData& member_data) {
+ReturnType& ClassMember(void* class_ptr, const TypeData& member_data) {
     assert(member_data.name != "unknown" && "Could not find member variable!");
     assert(member_data.type_hash == TypeHashID<ReturnType>() && "Did not request correct return type!");
     return *(reinterpret_cast<ReturnType*>(((char*)(class_ptr)) + member_data.offset));
 }
+// Hot path version, MemberInfo access never touches the heap (unknown_member has a type_hash of 0)
+template<typename ReturnType>
+ReturnType& ClassMember(void* class_ptr, const MemberInfo& member_info) {
+    assert(member_info.type_hash == TypeHashID<ReturnType>() && "Did not request correct return type!");
+    return *(reinterpret_cast<ReturnType*>(((char*)(class_ptr)) + member_info.offset));
+}
+
+// #################### Member Handles ####################
+// Member accessor resolved once (name lookup and type check happen in the constructor), access is a single pointer
+// add with no checks. Nested member paths ("position.x") resolve the same way, see MemberPath(). Handle is invalid
+// if member was not found or is not of MemberType, check valid() after resolving.
+// Resolve after InitializeReflection(), handles are not updated if reflection is initialized again.
+//      MemberHandle<std::vector<double>> position(TypeHashID<Transform2D>(), "position");
+//      if (position.valid()) position(&t)[0] = 1.0;
+template <typename MemberType>
+class MemberHandle {
+public:
+    MemberHandle() = default;
+    MemberHandle(TypeHash class_hash, const char* member_path)   { Resolve(class_hash, TryMemberPath(class_hash, member_path)); }
+    MemberHandle(TypeHash class_hash, NameHash member_path)      { Resolve(class_hash, TryMemberPath(class_hash, member_path)); }
+    MemberHandle(TypeHash class_hash, int member_index)          { Resolve(class_hash, TryMemberInfo(class_hash, member_index)); }
+
+    bool                valid() const                       { return m_valid; }
+    TypeHash            class_hash() const                  { return m_class_hash; }
+    size_t              offset() const                      { return m_offset; }
+
+    MemberType&         Get(void* class_ptr) const          { return *(reinterpret_cast<MemberType*>(((char*)(class_ptr)) + m_offset)); }
+    const MemberType&   Get(const void* class_ptr) const    { return *(reinterpret_cast<const MemberType*>(((const char*)(class_ptr)) + m_offset)); }
+    MemberType&         operator()(void* class_ptr) const         { return Get(class_ptr); }
+    const MemberType&   operator()(const void* class_ptr) const   { return Get(class_ptr); }
+
+private:
+    void Resolve(TypeHash class_hash, const MemberInfo* member_info) {
+        m_class_hash = class_hash;
+        m_valid = (member_info != nullptr && member_info->type_hash == TypeHashID<MemberType>());
+        m_offset = m_valid ? member_info->offset : 0;
+    }
+
+    size_t              m_offset        { 0 };                                      // Byte offset of member in class
+    TypeHash            m_class_hash    { 0 };                                      // Class the handle was resolved against
+    bool                m_valid         { false };                                  // Member found and of type MemberType
+};
+
+// Debug checked handle, every access asserts the handle is valid and was resolved against the current registry
+// generation (catches handles kept across InitializeReflection()). Same cost as MemberHandle when NDEBUG is defined.
+template <typename MemberType>
+class CheckedMemberHandle : public MemberHandle<MemberType> {
+public:
+    CheckedMemberHandle() = default;
+    CheckedMemberHandle(TypeHash class_hash, const char* member_path) : MemberHandle<MemberType>(class_hash, member_path) { }
+    CheckedMemberHandle(TypeHash class_hash, NameHash member_path)    : MemberHandle<MemberType>(class_hash, member_path) { }
+    CheckedMemberHandle(TypeHash class_hash, int member_index)        : MemberHandle<MemberType>(class_hash, member_index) { }
+
+    uint64_t            generation() const                  { return m_generation; }
+
+    MemberType&         Get(void* class_ptr) const          { Check(class_ptr); return MemberHandle<MemberType>::Get(class_ptr); }
+    const MemberType&   Get(const void* class_ptr) const    { Check(class_ptr); return MemberHandle<MemberType>::Get(class_ptr); }
+    MemberType&         operator()(void* class_ptr) const         { return Get(class_ptr); }
+    const MemberType&   operator()(const void* class_ptr) const   { return Get(class_ptr); }
+
+private:
+    void Check(const void* class_ptr) const {
+        (void)class_ptr;
+        assert(class_ptr != nullptr && "Member handle used with null class pointer!");
+        assert(this->valid() && "Member handle not resolved, member not found or wrong member type!");
+        assert(m_generation == ReflectionGeneration() && "Member handle resolved against a previous registry, resolve again!");
+    }
+
+    uint64_t            m_generation    { ReflectionGeneration() };                 // Registry generation at resolve
+};
+
+// #################### Type Erased Member Operations ####################
+// Single indirect call through the member's MemberThunks, no type checks needed. Class pointers are to class
+// instances, returns "" / false when member type does not support operation.
+inline std::string MemberToString(const void* class_ptr, const MemberInfo& member_info) {
+    if (member_info.thunks == nullptr || member_info.thunks->to_string == nullptr) return std::string();
+    return member_info.thunks->to_string(((const char*)(class_ptr)) + member_info.offset);
+}
+inline bool MemberFromString(void* class_ptr, const MemberInfo& member_info, const std::string& text) {
+    if (member_info.thunks == nullptr || member_info.thunks->from_string == nullptr) return false;
+    return member_info.thunks->from_string(((char*)(class_ptr)) + member_info.offset, text);
+}
+inline bool MemberCopy(void* dst_class_ptr, const void* src_class_ptr, const MemberInfo& member_info) {
+    if (member_info.thunks == nullptr || member_info.thunks->copy == nullptr) return false;
+    member_info.thunks->copy(((char*)(dst_class_ptr)) + member_info.offset, ((const char*)(src_class_ptr)) + member_info.offset);
+    return true;
+}
+inline bool MemberEquals(const void* a_class_ptr, const void* b_class_ptr, const MemberInfo& member_info) {
+    if (member_info.thunks == nullptr || member_info.thunks->equal == nullptr) return false;
+    return member_info.thunks->equal(((const char*)(a_class_ptr)) + member_info.offset, ((const char*)(b_class_ptr)) + member_info.offset);
+}
+inline size_t MemberHash(const void* class_ptr, const MemberInfo& member_info) {
+    if (member_info.thunks == nullptr || member_info.thunks->hash == nullptr) return 0;
+    return member_info.thunks->hash(((const char*)(class_ptr)) + member_info.offset);
+}
+
+// #################### Container Members ####################
+// Element access of container members (TYPE_FLAG_CONTAINER) without knowing the container type. Contiguous
+// containers expose their element buffer directly, so bulk code can work on it without copying the container.
+inline const ContainerThunks* MemberContainer(const MemberInfo& member_info) {
+    return (member_info.thunks != nullptr) ? member_info.thunks->container : nullptr;
+}
+inline size_t MemberElementCount(const void* class_ptr, const MemberInfo& member_info) {
+    const ContainerThunks* container = MemberContainer(member_info);
+    if (container == nullptr) return 0;
+    return container->size(((const char*)(class_ptr)) + member_info.offset);
+}
+inline void* MemberElementData(void* class_ptr, const MemberInfo& member_info) {
+    const ContainerThunks* container = MemberContainer(member_info);
+    if (container == nullptr) return nullptr;
+    return container->data(((char*)(class_ptr)) + member_info.offset);
+}
+inline void* MemberElementAt(void* class_ptr, const MemberInfo& member_info, size_t index) {
+    const ContainerThunks* container = MemberContainer(member_info);
+    if (container == nullptr || index >= container->size(((char*)(class_ptr)) + member_info.offset)) return nullptr;
+    return container->element(((char*)(class_ptr)) + member_info.offset, index);
+}
+inline bool MemberResize(void* class_ptr, const MemberInfo& member_info, size_t count) {
+    const ContainerThunks* container = MemberContainer(member_info);
+    if (container == nullptr) return false;
+    return container->resize(((char*)(class_ptr)) + member_info.offset, count);
+}
+// Typed view of elements of a contiguous container member, empty if member is not a contiguous container
+template <typename Element>
+ReflectRange<Element> MemberElements(void* class_ptr, const MemberInfo& member_info) {
+    ReflectRange<Element> range { };
+    const ContainerThunks* container = MemberContainer(member_info);
+    if (container == nullptr || !container->contiguous) return range;
+    assert(container->element_type_hash == TypeHashID<Element>() && "Did not request correct element type!");
+    void* container_ptr = ((char*)(class_ptr)) + member_info.offset;
+    range.first = static_cast<Element*>(container->data(container_ptr));
+    range.last =  range.first + container->size(container_ptr);
+    return range;
+}
+
+// #################### Reflected Copy ####################
+// Copies all registered members of class from src to dst (both existing instances of class type with class_hash),
+// adjacent trivially copyable members are copied as single memcpy runs. Returns false if class is not registered or
+// some member type is not copy assignable (other members are still copied).
+bool ReflectCopy(void* dst, const void* src, TypeHash class_hash);
+// Copies template instance src into each of 'count' contiguous existing instances starting at dst
+bool ReflectCloneArray(void* dst, const void* src, size_t count, TypeHash class_hash);
+template <typename T>
+bool ReflectCopy(T& dst, const T& src) {
+    return ReflectCopy(&dst, &src, TypeHashID<T>());
+}
+
+// #################### Binary Serialization ####################
+// Binary block layout (native byte order):
+//      char[4]     "RFL2"                          ("RFL1" blocks without type descriptors are still readable)
+//      string      class name                      (strings are uint32 length followed by chars)
+//      uint32      member count
+//      per member: string name, uint32 size, uint32 offset, uint8 encoding (BINARY_RAW / BINARY_BLOB),
+//                  uint64 type descriptor (TypeDescriptor<T>, 0 if unknown)
+//      uint64      record count
+//      records:    raw members are 'size' bytes, blob members are uint32 length followed by encoded value
+// Members are matched by name and type descriptor when reading, so records stay readable after members are added,
+// removed or retyped (retyped members are reset to default unless a migration rule converts them).
+enum Binary_Encoding {
+    BINARY_RAW =                        0,                                          // Trivially copyable, stored as bytes
+    BINARY_BLOB =                       1,                                          // Length prefixed encoding from member thunks
+};
+struct BinarySchemaMember {
+    std::string         name            { };                                        // Member variable name
+    uint32_t            size            { 0 };                                      // Size of member type when written
+    uint32_t            offset          { 0 };                                      // Char* offset of member when written
+    uint8_t             encoding        { BINARY_RAW };                             // Binary_Encoding of member data
+    uint64_t            descriptor      { 0 };                                      // Stable type descriptor of member when written, 0 if unknown
+};
+struct BinarySchema {
+    std::string         class_name      { };                                        // Class name when written
+    std::vector<BinarySchemaMember> members { };                                    // Members in the order they're stored in records
+    uint64_t            record_count    { 0 };                                      // Number of records following schema
+};
+// Builds schema of currently registered members of class (members that can't be encoded are left out)
+BinarySchema ReflectSchema(TypeHash class_hash);
+// Appends schema header to buffer / parses schema header, advancing cursor (false on malformed data)
+void ReflectWriteSchema(std::vector<char>& buffer, const BinarySchema& schema);
+bool ReflectReadSchema(const char*& cursor, const char* end, BinarySchema& schema);
+// Appends binary block (schema and 'count' records) of contiguous class instances to buffer
+bool ReflectWrite(std::vector<char>& buffer, const void* objects, size_t count, TypeHash class_hash);
+// Reads up to 'max_count' records of binary block into existing contiguous class instances, returns records read.
+// Reading stops at the first record that is truncated or has a member that fails to decode (or convert), records
+// before it are complete, the instance of the failed record may be partially overwritten.
+size_t ReflectRead(const char* data, size_t length, void* objects, size_t max_count, TypeHash class_hash, size_t* bytes_read = nullptr);
+template <typename T>
+bool ReflectWrite(std::vector<char>& buffer, const T& object) {
+    return ReflectWrite(buffer, &object, 1, TypeHashID<T>());
+}
+template <typename T>
+bool ReflectRead(const std::vector<char>& buffer, T& object) {
+    return ReflectRead(buffer.data(), buffer.size(), &object, 1, TypeHashID<T>()) == 1;
+}
+
+// #################### Schema Versioning ####################
+// Stable fingerprint (FNV-1a) of class name and stored members (name, size, offset, encoding, type descriptor),
+// changes whenever the binary layout of a class changes. ReflectRead() loads records through a migration plan that is
+// built once per (class, stored fingerprint) and cached: raw runs are copied, blobs decoded, removed / retyped members
+// skipped, new members reset to their default value and rules applied, without name lookups per record.
+uint64_t ReflectFingerprint(const BinarySchema& schema);
+uint64_t ReflectFingerprint(TypeHash class_hash);                                   // Fingerprint of current class schema
+// Migration plan for loading records written with 'stored' schema into class, cached (thread safe)
+const MigrationPlan& ReflectMigrationPlan(const BinarySchema& stored, TypeHash class_hash);
+// Loads stored member into current member (renames), through 'convert' when given (type changes, convert gets raw
+// bytes or blob contents). Add rules after InitializeReflection(), before reading old data of class.
+void AddMigrationRule(TypeHash class_hash, const char* stored_member, const char* member, MigrateConvertFunc convert = nullptr);
+template <typename T>
+uint64_t ReflectFingerprint() {
+    return ReflectFingerprint(TypeHashID<T>());
+}
+
+// #################### Memory Mapped Snapshots ####################
+// Snapshot file layout: binary schema header (raw members only), uint32 record size, padding to 16 bytes, then
+// fixed size records that are images of the class with raw (trivially copyable) members at their stored offsets.
+// SnapshotReader memory maps the file, fields are read in place without deserializing.
+struct SnapshotMember {
+    int                 offset          { -1 };                                     // Char* offset of member within record, -1 if not found
+    uint32_t            size            { 0 };                                      // Size of member when written
+    bool                valid() const   { return offset >= 0; }
+};
+// Writes snapshot file of 'count' contiguous class instances
+bool ReflectWriteSnapshot(const std::string& file_name, const void* objects, size_t count, TypeHash class_hash);
+class SnapshotReader
+{
+public:
+    SnapshotReader() = default;
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+    ~SnapshotReader() { Close(); }
+
+    bool                Open(const std::string& file_name);                         // Maps file, false if missing / malformed
+    void                Close();                                                    // Unmaps file
+    const BinarySchema& Schema() const  { return m_schema; }                        // Schema of stored records
+    size_t              RecordCount() const { return static_cast<size_t>(m_schema.record_count); }
+    size_t              RecordSize() const { return m_record_size; }
+    const char*         Record(size_t index) const { return m_records + index * m_record_size; }
+    SnapshotMember      Member(const char* member_name) const;                       // Find stored member by name
+    SnapshotMember      Member(const MemberInfo& member_info) const;                // Find stored member matching registered member (name, size and type)
+
+    // Reference to member value of record in place (member type must match the stored member)
+    template <typename T>
+    const T& Get(size_t index, const SnapshotMember& member) const {
+        assert(member.valid() && member.size == sizeof(T) && "Snapshot member not found or wrong type requested!");
+        return *(reinterpret_cast<const T*>(Record(index) + member.offset));
+    }
+
+private:
+    BinarySchema        m_schema        { };                                        // Schema of stored records
+    const char*         m_data          { nullptr };                                // Mapped file
+    size_t              m_length        { 0 };                                      // Length of mapped file
+    const char*         m_records       { nullptr };                                // Start of records within mapped file
+    size_t              m_record_size   { 0 };                                      // Size of each record
+    std::vector<char>   m_fallback      { };                                        // File contents when memory mapping is unavailable
+};
+
+// #################### Diff / Delta ####################
+// Bitmask of members (by member index) whose values differ between instances a and b. Adjacent bitwise comparable
+// members are compared as one memcmp run first, members that can't be compared are always reported as different.
+MemberMask ReflectDiff(const void* a, const void* b, TypeHash class_hash);
+// Appends delta of members set in mask (uint64 class fingerprint, uint32 word count, mask words, then member values) to
+// buffer. Deltas are encoded by member index, deltas from a peer with a different class fingerprint are rejected.
+void ReflectEncodeDelta(std::vector<char>& buffer, const void* object, const MemberMask& mask, TypeHash class_hash);
+// Applies delta from ReflectEncodeDelta() onto existing instance, false (instance untouched) on malformed data or a
+// member value that fails to decode
+bool ReflectApplyDelta(void* object, const char* data, size_t length, TypeHash class_hash, size_t* bytes_read = nullptr);
+// Copies members set in mask from src to dst
+void ReflectApplyDelta(void* dst, const void* src, const MemberMask& mask, TypeHash class_hash);
+template <typename T>
+MemberMask ReflectDiff(const T& a, const T& b) {
+    return ReflectDiff(&a, &b, TypeHashID<T>());
+}
+
+// #################### Hashing / Equality ####################
+// Content hash and equality of all registered members, walks the class compare plan: adjacent bitwise comparable
+// members are hashed / compared as one run, other members use their hash / equal thunks. Equal instances always hash
+// the same (members with equality but no hash are left out of the hash). Hashes use std::hash for non trivial members
+// so are only stable within one build. ReflectEquals() is false when the class is not registered or has a member that
+// can't be compared.
+size_t ReflectHash(const void* object, TypeHash class_hash);
+bool ReflectEquals(const void* a, const void* b, TypeHash class_hash);
+template <typename T>
+size_t ReflectHash(const T& object) {
+    return ReflectHash(&object, TypeHashID<T>());
+}
+template <typename T>
+bool ReflectEquals(const T& a, const T& b) {
+    return ReflectEquals(&a, &b, TypeHashID<T>());
+}
+// Hash / equality functors for hashed containers, std::unordered_map<T, Value, ReflectHasher<T>, ReflectEqualTo<T>>
+template <typename T>
+struct ReflectHasher    { size_t operator()(const T& object) const { return ReflectHash(&object, TypeHashID<T>()); } };
+template <typename T>
+struct ReflectEqualTo   { bool operator()(const T& a, const T& b) const { return ReflectEquals(&a, &b, TypeHashID<T>()); } };
+
+// #################### Change Tracking ####################
+// Assigns value to member, returns false (and leaves member untouched) when value already matches
+template <typename T>
+bool ThunkAssignChanged(T& dst, const T& value, std::true_type)     { if (dst == value) return false; dst = value; return true; }
+template <typename T>
+bool ThunkAssignChanged(T& dst, const T& value, std::false_type)    { dst = value; return true; }
+
+// Tracked write, sets member value and marks member index in dirty mask if the value changed, fails (member untouched)
+// on type mismatch or an unknown member (index -1)
+template <typename T, typename Member>
+bool SetMember(void* class_ptr, const Member& member, const T& value, MemberMask& dirty) {
+    assert(member.type_hash == TypeHashID<T>() && "Member type does not match value type!");
+    if (member.type_hash != TypeHashID<T>() || member.index < 0) return false;
+    bool changed = ThunkAssignChanged(ClassMember<T>(class_ptr, member), value, std::integral_constant<bool, ThunkTraits<T>::equal>());
+    if (changed) dirty.Set(member.index);
+    return changed;
+}
+
+// Per instance dirty masks for tracked writes, for consumers (undo, autosave, network) to process only changed members
+class ChangeTracker
+{
+public:
+    // Tracked write, see SetMember()
+    template <typename T, typename Member>
+    bool                SetMember(void* class_ptr, const Member& member, const T& value) {
+        MemberMask scratch { };
+        if (!::SetMember(class_ptr, member, value, scratch)) return false;
+        m_dirty[class_ptr].Set(member.index);
+        return true;
+    }
+    void                MarkDirty(const void* class_ptr, int member_index) { if (member_index >= 0) m_dirty[class_ptr].Set(member_index); }
+    bool                IsDirty(const void* class_ptr) const;                       // True if any member of instance was changed
+    const MemberMask&   Dirty(const void* class_ptr) const;                         // Changed members of instance, empty mask if clean
+    void                Clear(const void* class_ptr)    { m_dirty.erase(class_ptr); }
+    void                ClearAll()                      { m_dirty.clear(); }
+    // Calls func(const void* class_ptr, const MemberMask& dirty) for every changed instance
+    template <typename Func>
+    void                ForEachDirty(Func func) const   { for (const auto& pair : m_dirty) func(pair.first, pair.second); }
+
+private:
+    std::unordered_map<const void*, MemberMask> m_dirty { };                        // Dirty masks by instance pointer
+};
+
+//####################################################################################
+//##    Batch Member Gather / Scatter
+//##        Moves one member of many instances (base + i * stride) into / out of a dense buffer. Type is checked
+//##        once per call, 4 / 8 byte scalars use strided copy kernels (AVX2 gathers when compiled with AVX2).
+//############################
+// Strided copy kernels, 'Size' is the byte size of the member
+template <size_t Size>
+void GatherKernel(const char* src, size_t stride, size_t count, char* out) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    if ((Size == 4 || Size == 8) && stride * 7 <= 0x7fffffff) {
+        const int s = static_cast<int>(stride);
+        if (Size == 4) {
+            const __m256i offsets = _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+            for (; i + 8 <= count; i += 8) {
+                __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src + i * stride), offsets, 1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * Size), values);
+            }
+        } else {
+            const __m128i offsets = _mm_setr_epi32(0, s, 2 * s, 3 * s);
+            for (; i + 4 <= count; i += 4) {
+                __m256i values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(src + i * stride), offsets, 1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * Size), values);
+            }
+        }
+    }
+#endif
+    for (; i + 4 <= count; i += 4) {
+        memcpy(out + (i + 0) * Size, src + (i + 0) * stride, Size);
+        memcpy(out + (i + 1) * Size, src + (i + 1) * stride, Size);
+        memcpy(out + (i + 2) * Size, src + (i + 2) * stride, Size);
+        memcpy(out + (i + 3) * Size, src + (i + 3) * stride, Size);
+    }
+    for (; i < count; ++i) memcpy(out + i * Size, src + i * stride, Size);
+}
+template <size_t Size>
+void ScatterKernel(const char* in, size_t stride, size_t count, char* dst) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        memcpy(dst + (i + 0) * stride, in + (i + 0) * Size, Size);
+        memcpy(dst + (i + 1) * stride, in + (i + 1) * Size, Size);
+        memcpy(dst + (i + 2) * stride, in + (i + 2) * Size, Size);
+        memcpy(dst + (i + 3) * stride, in + (i + 3) * Size, Size);
+    }
+    for (; i < count; ++i) memcpy(dst + i * stride, in + i * Size, Size);
+}
+
+// Trivially copyable members use the kernels, other members are assigned one by one
+template <typename Ret>
+void GatherValues(const char* src, size_t stride, size_t count, Ret* out, std::true_type /* trivial */) {
+    GatherKernel<sizeof(Ret)>(src, stride, count, (char*)(out));
+}
+template <typename Ret>
+void GatherValues(const char* src, size_t stride, size_t count, Ret* out, std::false_type /* trivial */) {
+    for (size_t i = 0; i < count; ++i) out[i] = *reinterpret_cast<const Ret*>(src + i * stride);
+}
+template <typename Ret>
+void ScatterValues(const Ret* in, size_t stride, size_t count, char* dst, std::true_type /* trivial */) {
+    ScatterKernel<sizeof(Ret)>((const char*)(in), stride, count, dst);
+}
+template <typename Ret>
+void ScatterValues(const Ret* in, size_t stride, size_t count, char* dst, std::false_type /* trivial */) {
+    for (size_t i = 0; i < count; ++i) *reinterpret_cast<Ret*>(dst + i * stride) = in[i];
+}
+
+// Copies member of 'count' instances (first instance at base, instances 'stride' bytes apart) into out[0..count)
+template <typename Ret>
+void GatherMember(const void* base, size_t stride, size_t count, const MemberInfo& member_info, Ret* out) {
+    assert(member_info.type_hash == TypeHashID<Ret>() && "Did not request correct member type!");
+    GatherValues(((const char*)(base)) + member_info.offset, stride, count, out, std::integral_constant<bool, std::is_trivially_copyable<Ret>::value>());
+}
+template <typename Ret>
+void GatherMember(const void* base, size_t stride, size_t count, const TypeData& member_data, Ret* out) {
+    assert(member_data.type_hash == TypeHashID<Ret>() && "Did not request correct member type!");
+    GatherValues(((const char*)(base)) + member_data.offset, stride, count, out, std::integral_constant<bool, std::is_trivially_copyable<Ret>::value>());
+}
+// Copies in[0..count) into member of 'count' instances (first instance at base, instances 'stride' bytes apart)
+template <typename Ret>
+void ScatterMember(void* base, size_t stride, size_t count, const MemberInfo& member_info, const Ret* in) {
+    assert(member_info.type_hash == TypeHashID<Ret>() && "Did not request correct member type!");
+    ScatterValues(in, stride, count, ((char*)(base)) + member_info.offset, std::integral_constant<bool, std::is_trivially_copyable<Ret>::value>());
+}
+template <typename Ret>
+void ScatterMember(void* base, size_t stride, size_t count, const TypeData& member_data, const Ret* in) {
+    assert(member_data.type_hash == TypeHashID<Ret>() && "Did not request correct member type!");
+    ScatterValues(in, stride, count, ((char*)(base)) + member_data.offset, std::integral_constant<bool, std::is_trivially_copyable<Ret>::value>());
+}
+
+//####################################################################################
+//##    Structure of Arrays
+//##        Reflection driven SoA storage, each registered member of T is stored in its own contiguous, aligned
+//##        column. Requires InitializeReflection() before use. Only registered members are stored.
+//############################
+template <typename T>
+class SoAArray
+{
+public:
+    static const size_t k_alignment = 64;                                           // Column alignment (cache line)
+
+    explicit SoAArray(size_t count = 0) {
+        for (const MemberInfo& member : MemberInfos<T>()) {
+            // Trivially copyable members (including C arrays) are zero filled and memcpy'd, only others need thunks
+            assert(((member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) != 0 ||
+                    (member.thunks != nullptr && member.thunks->construct != nullptr && member.thunks->move != nullptr)) &&
+                "Member of SoAArray must be trivially copyable, or default constructible and move assignable!");
+            Column column { };
+            column.member = &member;
+            m_columns.push_back(column);
+        }
+        resize(count);
+    }
+    SoAArray(const SoAArray&) = delete;
+    SoAArray& operator=(const SoAArray&) = delete;
+    SoAArray(SoAArray&& other) { swap(other); }
+    SoAArray& operator=(SoAArray&& other) { swap(other); return *this; }
+    ~SoAArray() { Release(); }
+
+    size_t              size() const    { return m_count; }
+    bool                empty() const   { return m_count == 0; }
+    void                swap(SoAArray& other) { m_columns.swap(other.m_columns); std::swap(m_count, other.m_count); }
+
+    // Resizes all columns, existing values are kept (moved), new values are default constructed
+    void resize(size_t count) {
+        if (count == m_count) return;
+        for (Column& column : m_columns) {
+            const MemberInfo& member = *column.member;
+            bool trivial = (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) != 0;
+            char* raw = nullptr;
+            char* data = nullptr;
+            if (count > 0) {
+                raw = static_cast<char*>(REFLECT_MALLOC(count * member.size + k_alignment));
+                assert(raw != nullptr && "SoAArray allocation failed!");
+                data = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(raw) + k_alignment - 1) & ~(static_cast<uintptr_t>(k_alignment) - 1));
+            }
+            size_t keep = std::min(count, m_count);
+            for (size_t i = 0; i < count; ++i) {
+                char* dst = data + i * member.size;
+                if (trivial) {
+                    if (i < keep) memcpy(dst, column.data + i * member.size, member.size); else memset(dst, 0, member.size);
+                } else {
+                    member.thunks->construct(dst);
+                    if (i < keep) member.thunks->move(dst, column.data + i * member.size);
+                }
+            }
+            if (!trivial) {
+                for (size_t i = 0; i < m_count; ++i) member.thunks->destroy(column.data + i * member.size);
+            }
+            REFLECT_FREE(column.raw);
+            column.raw = raw;
+            column.data = data;
+        }
+        m_count = count;
+    }
+
+    // Contiguous column of member values, 'size()' elements long
+    template <typename MemberType>
+    MemberType* GetColumn(const MemberInfo& member_info) {
+        assert(member_info.type_hash == TypeHashID<MemberType>() && "Did not request correct column type!");
+        assert(member_info.index >= 0 && member_info.index < static_cast<int>(m_columns.size()) && "Member is not part of this SoAArray!");
+        return reinterpret_cast<MemberType*>(m_columns[member_info.index].data);
+    }
+    template <typename MemberType>
+    MemberType* GetColumn(const TypeData& member_data) {
+        return GetColumn<MemberType>(GetMemberInfo(TypeHashID<T>(), member_data.index));
+    }
+    // Untyped column access, element 'i' is at GetColumnData(member) + i * member.size
+    void* GetColumnData(const MemberInfo& member_info) {
+        return m_columns[member_info.index].data;
+    }
+
+    // Copies registered members of instance at 'index' into / out of the columns
+    void Write(size_t index, const T& object) {
+        for (Column& column : m_columns) {
+            const MemberInfo& member = *column.member;
+            if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+                memcpy(column.data + index * member.size, ((const char*)(&object)) + member.offset, member.size);
+            } else if (member.thunks->copy != nullptr) {
+                member.thunks->copy(column.data + index * member.size, ((const char*)(&object)) + member.offset);
+            }
+        }
+    }
+    void Read(size_t index, T& object) const {
+        for (const Column& column : m_columns) {
+            const MemberInfo& member = *column.member;
+            if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+                memcpy(((char*)(&object)) + member.offset, column.data + index * member.size, member.size);
+            } else if (member.thunks->copy != nullptr) {
+                member.thunks->copy(((char*)(&object)) + member.offset, column.data + index * member.size);
+            }
+        }
+    }
+
+    // Conversion from / to array of structs, column by column (ToAoS writes into 'size()' existing instances)
+    void FromAoS(const T* objects, size_t count) {
+        resize(count);
+        for (Column& column : m_columns) {
+            const MemberInfo& member = *column.member;
+            const char* src = ((const char*)(objects)) + member.offset;
+            char* dst = column.data;
+            bool trivial = (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) != 0;
+            for (size_t i = 0; i < count; ++i, src += sizeof(T), dst += member.size) {
+                if (trivial) memcpy(dst, src, member.size); else if (member.thunks->copy != nullptr) member.thunks->copy(dst, src);
+            }
+        }
+    }
+    void ToAoS(T* objects) const {
+        for (const Column& column : m_columns) {
+            const MemberInfo& member = *column.member;
+            const char* src = column.data;
+            char* dst = ((char*)(objects)) + member.offset;
+            bool trivial = (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) != 0;
+            for (size_t i = 0; i < m_count; ++i, src += member.size, dst += sizeof(T)) {
+                if (trivial) memcpy(dst, src, member.size); else if (member.thunks->copy != nullptr) member.thunks->copy(dst, src);
+            }
+        }
+    }
+
+private:
+    struct Column {
+        const MemberInfo*   member      { nullptr };                                // Registered member stored in column
+        char*               raw         { nullptr };                                // Allocation
+        char*               data        { nullptr };                                // Aligned start of column within allocation
+    };
+
+    void Release() {
+        for (Column& column : m_columns) {
+            if (column.member->thunks != nullptr && !(column.member->flags & TYPE_FLAG_TRIVIALLY_COPYABLE)) {
+                for (size_t i = 0; i < m_count; ++i) column.member->thunks->destroy(column.data + i * column.member->size);
+            }
+            REFLECT_FREE(column.raw);
+        }
+        m_columns.clear();
+        m_count = 0;
+    }
+
+    std::vector<Column> m_columns       { };                                        // One column per registered member, by member index
+    size_t              m_count         { 0 };                                      // Number of elements in each column
+};
+
+//####################################################################################
+//##    Parallel Instance Iteration
+//##        Splits a strided array of instances into chunks that worker threads claim from a shared counter (idle
+//##        workers keep taking chunks, so uneven work balances out). Relies on the registry being read only after
+//##        InitializeReflection(), member infos are resolved once and shared by all workers. Visitors must be safe to
+//##        call concurrently on different instances and must not throw. Runs on calling thread with REFLECT_NO_THREADS.
+//############################
+// Calls func(context, first, last) for chunks of [0, count) on up to thread_count threads (0 = hardware threads),
+// calling thread takes part. Returns once all chunks are done. Worker threads are started once and reused, calls
+// made while another call is running (or from inside a visitor) run on the calling thread.
+void ReflectParallelFor(size_t count, size_t grain, int thread_count, void (*func)(void* context, size_t first, size_t last), void* context);
+
+// Visits instance i at (base + i * stride), visitor(void* instance, size_t index, MemberInfoRange members)
+template <typename Visitor>
+void ForEachInstanceParallel(void* base, size_t stride, size_t count, TypeHash class_hash, Visitor&& visitor, int thread_count = 0, size_t grain = 0) {
+    using VisitorType = typename std::remove_reference<Visitor>::type;
+    struct Context {
+        char*           base;
+        size_t          stride;
+        MemberInfoRange members;
+        VisitorType*    visitor;
+    };
+    Context context { (char*)(base), stride, MemberInfos(class_hash), &visitor };
+    ReflectParallelFor(count, grain, thread_count, [](void* ptr, size_t first, size_t last) {
+        Context& chunk = *static_cast<Context*>(ptr);
+        for (size_t i = first; i < last; ++i) (*chunk.visitor)(static_cast<void*>(chunk.base + i * chunk.stride), i, chunk.members);
+    }, &context);
+}
+// Typed version over contiguous instances, visitor(T& instance, size_t index, MemberInfoRange members)
+template <typename T, typename Visitor>
+void ForEachInstanceParallel(T* instances, size_t count, Visitor&& visitor, int thread_count = 0, size_t grain = 0) {
+    using VisitorType = typename std::remove_reference<Visitor>::type;
+    struct Context {
+        T*              instances;
+        MemberInfoRange members;
+        VisitorType*    visitor;
+    };
+    Context context { instances, MemberInfos(TypeHashID<T>()), &visitor };
+    ReflectParallelFor(count, grain, thread_count, [](void* ptr, size_t first, size_t last) {
+        Context& chunk = *static_cast<Context*>(ptr);
+        for (size_t i = first; i < last; ++i) (*chunk.visitor)(chunk.instances[i], i, chunk.members);
+    }, &context);
+}
+
+//####################################################################################
+//##    Object Construction / Pools
+//##        Classes record size, alignment and construct / destroy thunks at registration, so instances can be
+//##        created from a TypeHash (e.g. loaded from disk) without a hand written factory.
+//############################
+// Default constructs class in place at 'memory' (sized / aligned for class), returns nullptr if class is not
+// registered or not default constructible
+void* ReflectConstruct(void* memory, TypeHash class_hash);
+// Calls destructor of class instance, false if class is not registered
+bool ReflectDestroy(void* object, TypeHash class_hash);
+
+// Slab allocated, correctly aligned instances of one class by TypeHash. Freed slots are reused (intrusive free
+// list), remaining instances are destroyed with the pool. Not thread safe, use one pool per thread.
+class ReflectPool
+{
+public:
+    explicit ReflectPool(TypeHash class_hash, size_t slab_count = 64);
+    ReflectPool(const ReflectPool&) = delete;
+    ReflectPool& operator=(const ReflectPool&) = delete;
+    ~ReflectPool();
+
+    void*               Create();                                                   // Default constructed instance, nullptr if class can't be constructed or allocation fails
+    size_t              Create(void** instances, size_t count);                     // Creates up to 'count' instances (stops when allocation fails), returns number created
+    void                Destroy(void* instance);                                    // Destroys instance created by this pool
+    void                Destroy(void* const* instances, size_t count);              // Destroys 'count' instances
+    void                Clear();                                                    // Destroys all instances, keeps slabs
+
+    TypeHash            ClassHash() const   { return m_class_hash; }
+    size_t              Size() const        { return m_live; }                      // Live instance count
+    size_t              Capacity() const    { return m_slabs.size() * m_slab_count; }
+    size_t              SlotSize() const    { return m_slot_size; }                 // Bytes between instances
+
+private:
+    struct Slab {
+        char*                   raw     { nullptr };                                // Allocation
+        char*                   data    { nullptr };                                // First slot (aligned)
+        std::vector<uint64_t>   live    { };                                        // Bit per slot, set if slot holds an instance
+    };
+    bool                AddSlab();
+    Slab*               FindSlab(const void* instance, size_t& slot);
+    void                PushFree(void* slot);
+
+    TypeHash            m_class_hash    { 0 };                                      // Class of instances
+    const MemberThunks* m_thunks        { nullptr };                                // Class construct / destroy
+    size_t              m_alignment     { 1 };                                      // Slot alignment
+    size_t              m_slot_size     { 0 };                                      // Class size rounded up to alignment
+    size_t              m_slab_count    { 0 };                                      // Slots per slab
+    size_t              m_live          { 0 };                                      // Live instances
+    std::vector<Slab>   m_slabs         { };                                        // Slabs, sorted by address
+    void*               m_free          { nullptr };                                // First free slot, next pointer stored in slot
+};
+template <typename T>
+T* ReflectPoolCreate(ReflectPool& pool) {
+    assert(pool.ClassHash() == TypeHashID<T>() && "Pool holds instances of a different class!");
+    return static_cast<T*>(pool.Create());
+}
+
+//####################################################################################
+//##    Compile Time Member Descriptors
+//############################
+// Specialized by REFLECT_STATIC(), 'members' is a std::tuple of member descriptor types, each with static
+// name(), pointer() (member pointer) and get(class_instance) functions.
+template <typename ClassType>
+struct ReflectStatic {
+    static constexpr bool reflected = false;
+    using members = std::tuple<>;
+};
+
+// Unrolls visitor calls over member descriptor tuple at compile time
+template <int Index, int Count>
+struct ReflectStaticVisit {
+    template <typename Members, typename ClassType, typename Visitor>
+    static void Visit(ClassType& class_instance, Visitor& visitor) {
+        using Member = typename std::tuple_element<Index, Members>::type;
+        visitor(Member::name(), Member::get(class_instance));
+        ReflectStaticVisit<Index + 1, Count>::template Visit<Members>(class_instance, visitor);
+    }
+};
+template <int Count>
+struct ReflectStaticVisit<Count, Count> {
+    template <typename Members, typename ClassType, typename Visitor>
+    static void Visit(ClassType&, Visitor&) { }
+};
+
+// Calls visitor(const char* member_name, MemberType& member) for each member declared with REFLECT_STATIC(), fully
+// inlined with no registry lookups. Visitor should be a functor with a templated operator().
+template <typename T, typename Visitor>
+void ForEachMember(T& class_instance, Visitor&& visitor) {
+    using Decay = typename std::remove_const<T>::type;
+    using Members = typename ReflectStatic<Decay>::members;
+    static_assert(ReflectStatic<Decay>::reflected, "Class has no compile time member descriptors, missing REFLECT_STATIC()?");
+    ReflectStaticVisit<0, std::tuple_size<Members>::value>::template Visit<Members>(class_instance, visitor);
+}
 
 //####################################################################################
 //##    Macros for Reflection Registration
@@ -386,12 +2429,16 @@ ReturnType& ClassMember(void* class_ptr, TypeData& member_data) {
         using T = TYPE; \
         TypeData class_data {}; \
 			class_data.name = #TYPE; \
+			class_data.name_literal = #TYPE; \
 			class_data.type_hash = typeid(TYPE).hash_code(); \
+			class_data.type_id = HashStringFNV1a(#TYPE); \
+        static_assert(!ReflectTypeID<TYPE>::declared || ReflectTypeID<TYPE>::value == HashStringFNV1a(#TYPE), \
+            "REFLECT_TYPE_ID() named a different class than REFLECT_CLASS()!"); \
 			class_data.title = #TYPE; \
             CreateTitle(class_data.title); \
 		RegisterClass<T>(class_data); \
 		int member_index = -1; \
-		std::unordered_map<int, TypeData> mbrs { };
+		TypeData mbr { };
 
 // Meta data functions
 #define CLASS_META_TITLE(STRING) \
@@ -402,35 +2449,167 @@ ReturnType& ClassMember(void* class_ptr, TypeData& member_data) {
         RegisterClass(class_data);
 
 // Member Registration
+//      (member is registered once all of its meta data is known, by the next REFLECT_MEMBER() or REFLECT_END())
 #define REFLECT_MEMBER(MEMBER) \
+        if (member_index >= 0) RegisterMember(class_data, mbr); \
 		member_index++; \
-		mbrs[member_index] = TypeData(); \
-		mbrs[member_index].name = #MEMBER; \
-        mbrs[member_index].index = member_index; \
-		mbrs[member_index].type_hash = typeid(T::MEMBER).hash_code(); \
-		mbrs[member_index].offset = offsetof(T, MEMBER); \
-		mbrs[member_index].size = sizeof(T::MEMBER); \
-		mbrs[member_index].title = #MEMBER; \
-        CreateTitle(mbrs[member_index].title); \
-		RegisterMember<decltype(T::MEMBER)>(class_data, mbrs[member_index]);
+		mbr = TypeData(); \
+		mbr.name = #MEMBER; \
+		mbr.name_literal = #MEMBER; \
+        mbr.index = member_index; \
+		mbr.type_hash = typeid(decltype(T::MEMBER)).hash_code(); \
+		mbr.offset = offsetof(T, MEMBER); \
+		mbr.size = sizeof(T::MEMBER); \
+		mbr.title = #MEMBER; \
+        CreateTitle(mbr.title); \
+		InitiateMember<decltype(T::MEMBER)>(mbr);
 
 // Meta data functions
 #define MEMBER_META_TITLE(STRING) \
-        mbrs[member_index].title = #STRING;	\
-        RegisterMember(class_data, mbrs[member_index]);
+        mbr.title = #STRING;
 #define MEMBER_META_DATA(KEY,VALUE) \
-        SetMetaData(mbrs[member_index], KEY, VALUE); \
-        RegisterMember(class_data, mbrs[member_index]);
+        SetMetaData(mbr, KEY, VALUE);
 
 // Static definitions add registration function to list of classes to be registered
 #define REFLECT_END(TYPE) \
+        if (member_index >= 0) RegisterMember(class_data, mbr); \
+        assert((!ReflectStatic<T>::reflected || std::tuple_size<ReflectStatic<T>::members>::value == member_index + 1) && \
+            "REFLECT_STATIC() and REFLECT_MEMBER() member lists do not match!"); \
     } \
     bool TYPE::reflection { initReflection() }; \
     bool TYPE::initReflection() { \
-        g_register_list.push_back(std::bind(&InitiateClass<TYPE>)); \
+        RegisterEntry entry { }; \
+        entry.type_hash = typeid(TYPE).hash_code(); \
+        entry.type_id = HashStringFNV1a(#TYPE); \
+        entry.name = #TYPE; \
+        entry.func = &InitiateClass<TYPE>; \
+        g_register_list.push_back(entry); \
         return true; \
     }
 
+// Enum Registration, place inside #ifdef REGISTER_REFLECTION like REFLECT_CLASS()
+//      REFLECT_ENUM(Shape_Type)
+//          REFLECT_ENUM_VALUE(SHAPE_TYPE_CIRCLE)
+//              ENUM_VALUE_TITLE("Circle")
+//          REFLECT_ENUM_VALUE(SHAPE_TYPE_BOX)
+//      REFLECT_ENUM_END(Shape_Type)
+#define REFLECT_ENUM(TYPE) \
+    template <> void InitiateEnum<TYPE>() { \
+        using E = TYPE; \
+        EnumData enum_data {}; \
+            enum_data.name = #TYPE; \
+            enum_data.title = #TYPE; \
+            CreateTitle(enum_data.title); \
+            enum_data.type_hash = typeid(TYPE).hash_code(); \
+            enum_data.size = sizeof(TYPE);
+#define REFLECT_ENUM_VALUE(VALUE) \
+        enum_data.values.push_back(EnumValueData()); \
+            enum_data.values.back().name = #VALUE; \
+            enum_data.values.back().title = #VALUE; \
+            CreateTitle(enum_data.values.back().title); \
+            enum_data.values.back().value = static_cast<int64_t>(E::VALUE);
+#define ENUM_VALUE_TITLE(STRING) \
+            enum_data.values.back().title = STRING;
+#define REFLECT_ENUM_END(TYPE) \
+        RegisterEnum(enum_data); \
+    } \
+    template <> bool EnumRegistration<TYPE>::registered = (g_enum_register_list.push_back(&InitiateEnum<TYPE>), true);
+
+// Variadic macro helpers (up to 64 members), used by REFLECT_STATIC
+#define REFLECT_EXPAND(x) x
+#define REFLECT_CONCAT_IMPL(a, b) a##b
+#define REFLECT_CONCAT(a, b) REFLECT_CONCAT_IMPL(a, b)
+#define REFLECT_SEP_NONE()
+#define REFLECT_SEP_COMMA() ,
+#define REFLECT_ARG_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, N, ...) N
+#define REFLECT_ARG_COUNT(...) REFLECT_EXPAND(REFLECT_ARG_N(__VA_ARGS__, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define REFLECT_FOR_EACH(M, SEP, ...) REFLECT_EXPAND(REFLECT_CONCAT(REFLECT_FOR_EACH_, REFLECT_ARG_COUNT(__VA_ARGS__))(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_1(M, SEP, x) M(x)
+#define REFLECT_FOR_EACH_2(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_1(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_3(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_2(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_4(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_3(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_5(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_4(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_6(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_5(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_7(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_6(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_8(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_7(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_9(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_8(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_10(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_9(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_11(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_10(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_12(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_11(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_13(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_12(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_14(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_13(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_15(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_14(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_16(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_15(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_17(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_16(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_18(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_17(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_19(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_18(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_20(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_19(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_21(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_20(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_22(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_21(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_23(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_22(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_24(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_23(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_25(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_24(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_26(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_25(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_27(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_26(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_28(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_27(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_29(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_28(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_30(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_29(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_31(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_30(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_32(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_31(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_33(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_32(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_34(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_33(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_35(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_34(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_36(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_35(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_37(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_36(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_38(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_37(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_39(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_38(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_40(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_39(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_41(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_40(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_42(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_41(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_43(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_42(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_44(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_43(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_45(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_44(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_46(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_45(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_47(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_46(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_48(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_47(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_49(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_48(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_50(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_49(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_51(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_50(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_52(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_51(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_53(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_52(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_54(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_53(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_55(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_54(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_56(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_55(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_57(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_56(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_58(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_57(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_59(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_58(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_60(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_59(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_61(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_60(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_62(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_61(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_63(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_62(M, SEP, __VA_ARGS__))
+#define REFLECT_FOR_EACH_64(M, SEP, x, ...) M(x) SEP() REFLECT_EXPAND(REFLECT_FOR_EACH_63(M, SEP, __VA_ARGS__))
+
+// Compile time member descriptors, place next to the struct declaration (OUTSIDE of #ifdef REGISTER_REFLECTION) so
+// ForEachMember() is available in every translation unit:
+//      REFLECT_STATIC(Transform2D, width, height, position)
+#define REFLECT_STATIC_MEMBER(MEMBER) \
+    struct Member_##MEMBER { \
+        using type = decltype(ClassType::MEMBER); \
+        static constexpr const char* name() { return #MEMBER; } \
+        static constexpr type ClassType::* pointer() { return &ClassType::MEMBER; } \
+        static type& get(ClassType& class_instance) { return class_instance.MEMBER; } \
+        static const type& get(const ClassType& class_instance) { return class_instance.MEMBER; } \
+    };
+#define REFLECT_STATIC_MEMBER_NAME(MEMBER) \
+    Member_##MEMBER
+#define REFLECT_STATIC(TYPE, ...) \
+    template <> struct ReflectStatic<TYPE> { \
+        using ClassType = TYPE; \
+        static constexpr bool reflected = true; \
+        REFLECT_FOR_EACH(REFLECT_STATIC_MEMBER, REFLECT_SEP_NONE, __VA_ARGS__) \
+        using members = std::tuple<REFLECT_FOR_EACH(REFLECT_STATIC_MEMBER_NAME, REFLECT_SEP_COMMA, __VA_ARGS__)>; \
+    };
+
 //####################################################################################
 //####################################################################################
 //####################################################################################
@@ -440,120 +2619,1485 @@ ReturnType& ClassMember(void* class_ptr, TypeData& member_data) {
 //####################################################################################
 #ifdef REGISTER_REFLECTION
 
+// Memory mapping for snapshots (falls back to reading whole file where unavailable)
+#include <cstdio>
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define REFLECT_HAS_MMAP
+#endif
+
+// Worker threads for parallel registration (define REFLECT_NO_THREADS to always register on calling thread)
+#ifndef REFLECT_NO_THREADS
+    #include <condition_variable>
+    #include <thread>
+#endif
+
 // Gloabls
 std::shared_ptr<SnReflect>      g_reflect           { nullptr };                    // Meta data singleton
-Functions                       g_register_list     { };                            // Keeps list of registration functions
+RegisterList                    g_register_list     { };                            // Keeps list of registration functions
+EnumRegisterList                g_enum_register_list { };                           // Keeps list of enum registration functions
+static thread_local SnReflect*  t_register_target   { nullptr };                    // Shard being registered into on this thread, nullptr for g_reflect
 
 // ########## General Registration ##########
+SnReflect* RegistrationTarget() {
+    return (t_register_target != nullptr) ? t_register_target : g_reflect.get();
+}
+
+uint64_t ReflectionGeneration() {
+    return (g_reflect != nullptr) ? g_reflect->generation : 0;
+}
+
+// Runs registration functions [first, last) into shard
+static void RegisterIntoShard(SnReflect* shard, const RegisterEntry* first, const RegisterEntry* last) {
+    t_register_target = shard;
+    for (const RegisterEntry* entry = first; entry != last; ++entry) {
+        entry->func();
+    }
+    t_register_target = nullptr;
+}
+
 // Initializes global reflection object, registers classes with reflection system
-void InitializeReflection() {
+void InitializeReflection(Reflect_Init mode, int thread_count) {
     // Create Singleton
+    static uint64_t s_generation = 0;
     g_reflect = std::make_shared<SnReflect>();
+    g_reflect->generation = ++s_generation;
+
+    // Enums are small, always registered up front on calling thread
+    for (void (*func)() : g_enum_register_list) func();
+    g_enum_register_list.clear();
+
+    // Lazy, only create empty class entries (so name lookups and table structure are fixed), tables filled on first query
+    if (mode == REFLECT_INIT_LAZY) {
+        for (const RegisterEntry& entry : g_register_list) {
+            TypeData& data = g_reflect->classes[entry.type_hash];
+            data.name = entry.name;
+            data.title = entry.name;
+            data.name_literal = entry.name;
+            data.type_hash = entry.type_hash;
+            data.type_id = entry.type_id;
+            g_reflect->IndexClass(data);
+            g_reflect->PrepareClass(entry.type_hash);
+            g_reflect->lazy_classes[entry.type_hash].func = entry.func;
+        }
+        g_register_list.clear();
+        g_reflect->lazy = true;
+        g_reflect->frozen = true;
+        return;
+    }
 
     // Register Structs / Classes
-    for (int func = 0; func < g_register_list.size(); ++func) {
-        g_register_list[func]();
+    size_t count = g_register_list.size();
+    #ifndef REFLECT_NO_THREADS
+    if (mode == REFLECT_INIT_PARALLEL) {
+        size_t threads = (thread_count > 0) ? static_cast<size_t>(thread_count) : static_cast<size_t>(std::thread::hardware_concurrency());
+        threads = std::max<size_t>(1, std::min(threads, count));
+        std::vector<std::unique_ptr<SnReflect>> shards(threads);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            shards[t].reset(new SnReflect());
+            const RegisterEntry* first = g_register_list.data() + (count * t) / threads;
+            const RegisterEntry* last =  g_register_list.data() + (count * (t + 1)) / threads;
+            workers.push_back(std::thread(RegisterIntoShard, shards[t].get(), first, last));
+        }
+        for (std::thread& worker : workers) worker.join();
+        for (std::unique_ptr<SnReflect>& shard : shards) g_reflect->MergeShard(*shard);
+        count = 0;
     }
+    #endif
+    RegisterIntoShard(g_reflect.get(), g_register_list.data(), g_register_list.data() + count);
     g_register_list.clear();        // Clean up
+
+    // Member tables are now frozen
+    g_reflect->Finalize();
 }
 
-// Used in registration macros to automatically create nice display name from class / member variable names
-void CreateTitle(std::string& name) {
-    // Replace underscores, capitalize first letters
-    std::replace(name.begin(), name.end(), '_', ' ');
-    name[0] = toupper(name[0]);
-    for (int c = 1; c < name.length(); c++) {
-        if (name[c - 1] == ' ') name[c] = toupper(name[c]);
+// Registers class on first query when reflection was initialized with REFLECT_INIT_LAZY
+void SnReflect::RequireLazy(TypeHash class_hash) {
+    auto it = lazy_classes.find(class_hash);
+    if (it == lazy_classes.end() || it->second.registered.load(std::memory_order_acquire)) return;
+    std::lock_guard<std::mutex> lock(lazy_mutex);
+    RegisterLazyLocked(class_hash);
+}
+
+// Registers lazy class, caller holds 'lazy_mutex' (also used to register nested member classes while finalizing)
+void SnReflect::RegisterLazyLocked(TypeHash class_hash) {
+    auto it = lazy_classes.find(class_hash);
+    if (it == lazy_classes.end() || it->second.registered.load(std::memory_order_relaxed)) return;
+
+    // Register into private shard, then move the whole entry into the existing (empty) one, as MergeShard() does. The
+    // identity the name / type id indexes were built from (name, name literal, type hash, type id) is restored
+    SnReflect shard;
+    t_register_target = &shard;
+    it->second.func();
+    t_register_target = nullptr;
+    auto registered = shard.classes.find(class_hash);
+    if (registered != shard.classes.end()) {
+        TypeData& data = classes.find(class_hash)->second;
+        std::string name = std::move(data.name);
+        const char* name_literal = data.name_literal;
+        TypeHash type_hash = data.type_hash;
+        TypeID type_id = data.type_id;
+        data = std::move(registered->second);
+        data.name = std::move(name);
+        data.name_literal = name_literal;
+        data.type_hash = type_hash;
+        data.type_id = type_id;
+        members.find(class_hash)->second = std::move(shard.members[class_hash]);
+        member_names.find(class_hash)->second = std::move(shard.member_names[class_hash]);
+        for (auto& pair : shard.meta_keys) {
+            InternMetaKey(pair.first, pair.second.c_str());
+        }
+        FinalizeClass(class_hash);
     }
+    it->second.registered.store(true, std::memory_order_release);
+}
+
+// FNV-1a string hash, used for class / member name indexes
+size_t HashString(const char* str) {
+    uint64_t hash = 14695981039346656037ULL;
+    while (*str != '\0') {
+        hash ^= static_cast<unsigned char>(*str++);
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
 
-    // Add spaces to seperate words
-    std::string title = "";
-    title += name[0];
-    for (int c = 1; c < name.length(); c++) {
-        if (islower(name[c - 1]) && isupper(name[c])) {
-            title += std::string(" ");
-        } else if ((isalpha(name[c - 1]) && isdigit(name[c]))) {
-            title += std::string(" ");
+// Used in registration macros to automatically create nice display name from class / member variable names
+void CreateTitle(std::string& name) {
+    // Replace underscores, capitalize first letters, add spaces to seperate words (single pass, at most one allocation)
+    if (name.empty()) return;
+    std::string title { };
+    title.reserve(name.length() * 2);
+    char previous = ' ';
+    for (size_t c = 0; c < name.length(); ++c) {
+        char current = (name[c] == '_') ? ' ' : name[c];
+        if (previous == ' ') {
+            current = static_cast<char>(toupper(static_cast<unsigned char>(current)));
+        } else if ((islower(static_cast<unsigned char>(previous)) && isupper(static_cast<unsigned char>(current))) ||
+                   (isalpha(static_cast<unsigned char>(previous)) && isdigit(static_cast<unsigned char>(current)))) {
+            title += ' ';
         }
-        title += name[c];
+        title += current;
+        previous = current;
     }
-    name = title;
+    name.swap(title);
 }
 
 // ########## Class / Member Registration ##########
 // Update class TypeData
-void RegisterClass(TypeData class_data) {
-	g_reflect->AddClass(class_data);
+void RegisterClass(const TypeData& class_data) {
+	RegistrationTarget()->AddClass(class_data);
 }
 
 // Update member TypeData
-void RegisterMember(TypeData class_data, TypeData member_data) {
-	g_reflect->AddMember(class_data, member_data);
+void RegisterMember(const TypeData& class_data, const TypeData& member_data) {
+	RegistrationTarget()->AddMember(class_data, member_data);
+}
+
+// ########## Enum Registration ##########
+// Builds lookup tables and stores enum, values are dense when their range is at most about twice their count
+void RegisterEnum(EnumData& enum_data) {
+    SnReflect* target = RegistrationTarget();
+    assert(!target->frozen && "Registry is frozen, enums must be registered before InitializeReflection() completes!");
+    enum_data.dense.clear();
+    enum_data.sparse.clear();
+    enum_data.names.clear();
+    if (!enum_data.values.empty()) {
+        int64_t min_value = enum_data.values[0].value;
+        int64_t max_value = enum_data.values[0].value;
+        for (const EnumValueData& value : enum_data.values) {
+            min_value = std::min(min_value, value.value);
+            max_value = std::max(max_value, value.value);
+        }
+        uint64_t range = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value);
+        bool dense = range < 2 * enum_data.values.size() + 64;
+        if (dense) {
+            enum_data.dense_min = min_value;
+            enum_data.dense.assign(static_cast<size_t>(range) + 1, -1);
+        }
+        for (size_t i = 0; i < enum_data.values.size(); ++i) {
+            const EnumValueData& value = enum_data.values[i];
+            // Aliased values keep first declared name
+            if (dense) {
+                int& index = enum_data.dense[static_cast<size_t>(value.value - min_value)];
+                if (index < 0) index = static_cast<int>(i);
+            } else {
+                enum_data.sparse.insert(std::make_pair(value.value, static_cast<int>(i)));
+            }
+            int& named = enum_data.names.insert(std::make_pair(HashString(value.name.c_str()), -1)).first->second;
+            assert(named == -1 && "Enum value name hash collision, two values of enum hash to the same name!");
+            named = static_cast<int>(i);
+        }
+    }
+    target->enums[enum_data.type_hash] = std::move(enum_data);
 }
 
 //####################################################################################
 //##    TypeData Fetching
 //####################################################################################
+// ########## Lookup Statistics ##########
+#ifdef REFLECT_ENABLE_STATS
+static std::atomic<uint64_t>    g_stat_lookups[STAT_API_COUNT][STAT_KEY_COUNT];    // Lookup counters
+static std::atomic<uint64_t>    g_stat_misses[STAT_API_COUNT][STAT_KEY_COUNT];     // Miss counters
+static std::atomic<uint64_t>    g_stat_unknown { 0 };                              // unknown_type / unknown_member returns
+static void RecordLookup(Stat_Api api, Stat_Key key, TypeHash class_hash, bool found) {
+    g_stat_lookups[api][key].fetch_add(1, std::memory_order_relaxed);
+    if (!found) g_stat_misses[api][key].fetch_add(1, std::memory_order_relaxed);
+    auto it = g_reflect->class_lookups.find(class_hash);
+    if (it != g_reflect->class_lookups.end()) it->second.fetch_add(1, std::memory_order_relaxed);
+}
+    #define REFLECT_STAT_LOOKUP(API, KEY, CLASS_HASH, FOUND)    RecordLookup(API, KEY, CLASS_HASH, FOUND)
+    #define REFLECT_STAT_UNKNOWN()                              g_stat_unknown.fetch_add(1, std::memory_order_relaxed)
+#else
+    #define REFLECT_STAT_LOOKUP(API, KEY, CLASS_HASH, FOUND)
+    #define REFLECT_STAT_UNKNOWN()
+#endif
+
+ReflectStats GetReflectionStats() {
+    ReflectStats stats { };
+    #ifdef REFLECT_ENABLE_STATS
+        stats.enabled = true;
+        for (int api = 0; api < STAT_API_COUNT; ++api) {
+            for (int key = 0; key < STAT_KEY_COUNT; ++key) {
+                stats.lookups[api][key] = g_stat_lookups[api][key].load(std::memory_order_relaxed);
+                stats.misses[api][key] =  g_stat_misses[api][key].load(std::memory_order_relaxed);
+            }
+        }
+        stats.unknown_returns = g_stat_unknown.load(std::memory_order_relaxed);
+        if (g_reflect != nullptr) {
+            for (auto& pair : g_reflect->class_lookups) {
+                uint64_t count = pair.second.load(std::memory_order_relaxed);
+                if (count > 0) stats.class_lookups.push_back(std::make_pair(pair.first, count));
+            }
+        }
+        std::sort(stats.class_lookups.begin(), stats.class_lookups.end(),
+            [](const std::pair<TypeHash, uint64_t>& a, const std::pair<TypeHash, uint64_t>& b) { return a.second > b.second; });
+    #endif
+    return stats;
+}
+
+void ResetReflectionStats() {
+    #ifdef REFLECT_ENABLE_STATS
+        for (int api = 0; api < STAT_API_COUNT; ++api) {
+            for (int key = 0; key < STAT_KEY_COUNT; ++key) {
+                g_stat_lookups[api][key].store(0, std::memory_order_relaxed);
+                g_stat_misses[api][key].store(0, std::memory_order_relaxed);
+            }
+        }
+        g_stat_unknown.store(0, std::memory_order_relaxed);
+        if (g_reflect != nullptr) {
+            for (auto& pair : g_reflect->class_lookups) pair.second.store(0, std::memory_order_relaxed);
+        }
+    #endif
+}
+
+// Reference to found TypeData, or unknown_type on a miss
+static TypeData& FoundOrUnknown(TypeData* data) {
+    if (data != nullptr) return *data;
+    REFLECT_STAT_UNKNOWN();
+    return unknown_type;
+}
+static const MemberInfo& FoundOrUnknown(const MemberInfo* info) {
+    if (info != nullptr) return *info;
+    REFLECT_STAT_UNKNOWN();
+    return unknown_member;
+}
+
 // ########## Class Data Fetching ##########
 // Class TypeData fetching from passed in class TypeHash
-TypeData& ClassData(TypeHash class_hash) {
-    for (auto& pair : g_reflect->classes) {
-        if (pair.first == class_hash) return pair.second;
-    }
-    return unknown_type;
+TypeData* TryClassData(TypeHash class_hash) {
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->classes.find(class_hash);
+    TypeData* data = (it != g_reflect->classes.end()) ? &(it->second) : nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_CLASS_DATA, STAT_KEY_HASH, class_hash, data != nullptr);
+    return data;
 }
 // Class TypeData fetching from passed in class name
-TypeData& ClassData(std::string class_name) {
-    for (auto& pair : g_reflect->classes) {
-        if (pair.second.name == class_name) return pair.second;
-    }
-    return unknown_type;
+TypeData* TryClassData(const std::string& class_name) {
+    return TryClassData(class_name.c_str());
 }
-// Class TypeData fetching from passed in class name
-TypeData& ClassData(const char* class_name) {
-    return ClassData(std::string(class_name));
+// Class TypeData fetching from passed in class name, hashed lookup without creating a std::string
+TypeData* TryClassData(const char* class_name) {
+    auto it = g_reflect->class_names.find(HashString(class_name));
+    TypeData* data = (it != g_reflect->class_names.end() && it->second->name == class_name) ? it->second : nullptr;
+    if (data != nullptr) g_reflect->Require(data->type_hash);
+    REFLECT_STAT_LOOKUP(STAT_API_CLASS_DATA, STAT_KEY_NAME, data ? data->type_hash : 0, data != nullptr);
+    return data;
+}
+// Class TypeData fetching from precomputed class name hash
+TypeData* TryClassData(NameHash class_name) {
+    auto it = g_reflect->class_names.find(class_name.value);
+    TypeData* data = (it != g_reflect->class_names.end()) ? it->second : nullptr;
+    if (data != nullptr) g_reflect->Require(data->type_hash);
+    REFLECT_STAT_LOOKUP(STAT_API_CLASS_DATA, STAT_KEY_NAME_HASH, data ? data->type_hash : 0, data != nullptr);
+    return data;
+}
+// Class TypeData fetching from stable type id
+TypeData* TryClassDataByID(TypeID type_id) {
+    auto it = g_reflect->type_ids.find(type_id);
+    TypeData* data = (it != g_reflect->type_ids.end()) ? it->second : nullptr;
+    if (data != nullptr) g_reflect->Require(data->type_hash);
+    REFLECT_STAT_LOOKUP(STAT_API_CLASS_DATA, STAT_KEY_ID, data ? data->type_hash : 0, data != nullptr);
+    return data;
 }
+TypeData& ClassData(TypeHash class_hash)                  { return FoundOrUnknown(TryClassData(class_hash)); }
+TypeData& ClassData(const std::string& class_name)        { return FoundOrUnknown(TryClassData(class_name)); }
+TypeData& ClassData(const char* class_name)               { return FoundOrUnknown(TryClassData(class_name)); }
+TypeData& ClassData(NameHash class_name)                  { return FoundOrUnknown(TryClassData(class_name)); }
+TypeData& ClassDataByID(TypeID type_id)                   { return FoundOrUnknown(TryClassDataByID(type_id)); }
 
 // ########## Member Data Fetching ##########
-// Member TypeData fetching by member variable index and class TypeHash
-TypeData& MemberData(TypeHash class_hash, int member_index) {
-    int count = 0;
-    for (auto& member : g_reflect->members[class_hash]) {
-        if (count == member_index) return member.second;
-        ++count;
+// Contiguous range of all member TypeData of class by class TypeHash, sorted by offset
+MemberRange Members(TypeHash class_hash) {
+    MemberRange range { };
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->members.find(class_hash);
+    if (it != g_reflect->members.end() && !it->second.empty()) {
+        range.first = it->second.data();
+        range.last =  it->second.data() + it->second.size();
     }
-    return unknown_type;
+    return range;
+}
+// Member index from member name index, -1 if not found
+static int MemberIndex(TypeHash class_hash, size_t name_hash) {
+    g_reflect->Require(class_hash);
+    auto names = g_reflect->member_names.find(class_hash);
+    if (names == g_reflect->member_names.end()) return -1;
+    auto it = names->second.find(name_hash);
+    return (it != names->second.end()) ? it->second : -1;
+}
+// Member TypeData fetching by member variable index and class TypeHash
+TypeData* TryMemberData(TypeHash class_hash, int member_index) {
+    MemberRange range = Members(class_hash);
+    TypeData* data = (member_index >= 0 && member_index < range.size()) ? &range[member_index] : nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_DATA, STAT_KEY_INDEX, class_hash, data != nullptr);
+    return data;
 }
 // Member TypeData fetching by member variable name and class TypeHash
-TypeData& MemberData(TypeHash class_hash, std::string member_name) {
-    for (auto& member : g_reflect->members[class_hash]) {
-        if (member.second.name == member_name) return member.second;
+TypeData* TryMemberData(TypeHash class_hash, const std::string& member_name) {
+    return TryMemberData(class_hash, member_name.c_str());
+}
+// Member TypeData fetching by member variable name and class TypeHash, hashed lookup without creating a std::string
+TypeData* TryMemberData(TypeHash class_hash, const char* member_name) {
+    int index = MemberIndex(class_hash, HashString(member_name));
+    TypeData* data = (index >= 0) ? &Members(class_hash)[index] : nullptr;
+    if (data != nullptr && data->name != member_name) data = nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_DATA, STAT_KEY_NAME, class_hash, data != nullptr);
+    return data;
+}
+// Member TypeData fetching by precomputed member variable name hash and class TypeHash
+TypeData* TryMemberData(TypeHash class_hash, NameHash member_name) {
+    int index = MemberIndex(class_hash, member_name.value);
+    TypeData* data = (index >= 0) ? &Members(class_hash)[index] : nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_DATA, STAT_KEY_NAME_HASH, class_hash, data != nullptr);
+    return data;
+}
+TypeData& MemberData(TypeHash class_hash, int member_index)                 { return FoundOrUnknown(TryMemberData(class_hash, member_index)); }
+TypeData& MemberData(TypeHash class_hash, const std::string& member_name)   { return FoundOrUnknown(TryMemberData(class_hash, member_name)); }
+TypeData& MemberData(TypeHash class_hash, const char* member_name)          { return FoundOrUnknown(TryMemberData(class_hash, member_name)); }
+TypeData& MemberData(TypeHash class_hash, NameHash member_name)             { return FoundOrUnknown(TryMemberData(class_hash, member_name)); }
+
+// ########## Member Info Fetching ##########
+// Contiguous range of all member MemberInfo of class by class TypeHash, sorted by offset
+MemberInfoRange MemberInfos(TypeHash class_hash) {
+    MemberInfoRange range { };
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->member_info.find(class_hash);
+    if (it != g_reflect->member_info.end()) range = it->second;
+    return range;
+}
+// MemberInfo fetching by class TypeHash and member variable index
+const MemberInfo* TryMemberInfo(TypeHash class_hash, int member_index) {
+    MemberInfoRange range = MemberInfos(class_hash);
+    const MemberInfo* info = (member_index >= 0 && member_index < range.size()) ? &range[member_index] : nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_INFO, STAT_KEY_INDEX, class_hash, info != nullptr);
+    return info;
+}
+// MemberInfo fetching by class TypeHash and member variable name, uses member name index
+const MemberInfo* TryMemberInfo(TypeHash class_hash, const char* member_name) {
+    int index = MemberIndex(class_hash, HashString(member_name));
+    const MemberInfo* info = (index >= 0) ? &MemberInfos(class_hash)[index] : nullptr;
+    if (info != nullptr && strcmp(info->name, member_name) != 0) info = nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_INFO, STAT_KEY_NAME, class_hash, info != nullptr);
+    return info;
+}
+// MemberInfo fetching by class TypeHash and precomputed member variable name hash
+const MemberInfo* TryMemberInfo(TypeHash class_hash, NameHash member_name) {
+    int index = MemberIndex(class_hash, member_name.value);
+    const MemberInfo* info = (index >= 0) ? &MemberInfos(class_hash)[index] : nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_INFO, STAT_KEY_NAME_HASH, class_hash, info != nullptr);
+    return info;
+}
+const MemberInfo& GetMemberInfo(TypeHash class_hash, int member_index)          { return FoundOrUnknown(TryMemberInfo(class_hash, member_index)); }
+const MemberInfo& GetMemberInfo(TypeHash class_hash, const char* member_name)   { return FoundOrUnknown(TryMemberInfo(class_hash, member_name)); }
+const MemberInfo& GetMemberInfo(TypeHash class_hash, NameHash member_name)      { return FoundOrUnknown(TryMemberInfo(class_hash, member_name)); }
+
+// ########## Enum Fetching ##########
+EnumData* TryEnumData(TypeHash enum_hash) {
+    auto it = g_reflect->enums.find(enum_hash);
+    return (it != g_reflect->enums.end()) ? &(it->second) : nullptr;
+}
+// Name of enum value, constant time
+const char* EnumToName(TypeHash enum_hash, int64_t value) {
+    const EnumData* data = TryEnumData(enum_hash);
+    if (data == nullptr) return nullptr;
+    int index = -1;
+    if (!data->dense.empty()) {
+        uint64_t slot = static_cast<uint64_t>(value) - static_cast<uint64_t>(data->dense_min);
+        if (slot < data->dense.size()) index = data->dense[static_cast<size_t>(slot)];
+    } else {
+        auto it = data->sparse.find(value);
+        if (it != data->sparse.end()) index = it->second;
+    }
+    return (index >= 0) ? data->values[index].name.c_str() : nullptr;
+}
+// Value of enum value name, constant time
+bool EnumFromName(TypeHash enum_hash, const char* name, int64_t& value) {
+    const EnumData* data = TryEnumData(enum_hash);
+    if (data == nullptr) return false;
+    auto it = data->names.find(HashString(name));
+    if (it == data->names.end() || data->values[it->second].name != name) return false;
+    value = data->values[it->second].value;
+    return true;
+}
+void EnumWrite(std::ostream& out, TypeHash enum_hash, int64_t value) {
+    const char* name = (g_reflect != nullptr) ? EnumToName(enum_hash, value) : nullptr;
+    if (name != nullptr) out << name; else out << value;
+}
+bool EnumRead(const std::string& text, TypeHash enum_hash, int64_t& value) {
+    if (g_reflect != nullptr && EnumFromName(enum_hash, text.c_str(), value)) return true;
+    if (text.empty()) return false;
+    char* end = nullptr;
+    long long number = strtoll(text.c_str(), &end, 10);
+    if (end == nullptr || *end != '\0') return false;
+    value = static_cast<int64_t>(number);
+    return true;
+}
+
+// ########## Member Path Fetching ##########
+// Flattened member path lookup by path hash
+static const MemberInfo* FindMemberPath(TypeHash class_hash, size_t path_hash) {
+    g_reflect->Require(class_hash);
+    auto paths = g_reflect->member_paths.find(class_hash);
+    if (paths == g_reflect->member_paths.end()) return nullptr;
+    auto it = paths->second.find(path_hash);
+    return (it != paths->second.end()) ? &(it->second) : nullptr;
+}
+// MemberInfo fetching by class TypeHash and member path ("position.x")
+const MemberInfo* TryMemberPath(TypeHash class_hash, const char* member_path) {
+    const MemberInfo* info = FindMemberPath(class_hash, HashString(member_path));
+    if (info != nullptr && strcmp(info->name, member_path) != 0) info = nullptr;
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_PATH, STAT_KEY_NAME, class_hash, info != nullptr);
+    return info;
+}
+// MemberInfo fetching by class TypeHash and precomputed member path hash
+const MemberInfo* TryMemberPath(TypeHash class_hash, NameHash member_path) {
+    const MemberInfo* info = FindMemberPath(class_hash, member_path.value);
+    REFLECT_STAT_LOOKUP(STAT_API_MEMBER_PATH, STAT_KEY_NAME_HASH, class_hash, info != nullptr);
+    return info;
+}
+const MemberInfo& MemberPath(TypeHash class_hash, const char* member_path)      { return FoundOrUnknown(TryMemberPath(class_hash, member_path)); }
+const MemberInfo& MemberPath(TypeHash class_hash, NameHash member_path)         { return FoundOrUnknown(TryMemberPath(class_hash, member_path)); }
+
+//####################################################################################
+//##    Reflected Copy
+//####################################################################################
+// Runs precomputed copy plan on a single instance
+inline void RunCopyPlan(const CopyPlan& plan, char* dst, const char* src) {
+    for (const CopyOp& op : plan.ops) {
+        if (op.copy == nullptr) {
+            memcpy(dst + op.offset, src + op.offset, op.size);
+        } else {
+            op.copy(dst + op.offset, src + op.offset);
+        }
     }
-    return unknown_type;
+}
+bool ReflectCopy(void* dst, const void* src, TypeHash class_hash) {
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->copy_plans.find(class_hash);
+    if (it == g_reflect->copy_plans.end()) return false;
+    RunCopyPlan(it->second, (char*)(dst), (const char*)(src));
+    return it->second.complete;
+}
+bool ReflectCloneArray(void* dst, const void* src, size_t count, TypeHash class_hash) {
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->copy_plans.find(class_hash);
+    if (it == g_reflect->copy_plans.end()) return false;
+    size_t stride = ClassData(class_hash).size;
+    char* dst_ptr = (char*)(dst);
+    for (size_t i = 0; i < count; ++i, dst_ptr += stride) {
+        RunCopyPlan(it->second, dst_ptr, (const char*)(src));
+    }
+    return it->second.complete;
+}
+
+//####################################################################################
+//##    Binary Serialization
+//####################################################################################
+// Single step of a binary read / write plan, adjacent raw members are merged into one memcpy run
+struct BinaryOp {
+    int                 offset          { -1 };                                     // Char* offset within class, -1 to skip
+    size_t              size            { 0 };                                      // Size of raw run in bytes
+    uint8_t             encoding        { BINARY_RAW };                             // Binary_Encoding of step
+    const MemberInfo*   member          { nullptr };                                // Member for blob steps
+};
+
+// Schema of class from registry tables, class must already be registered (used while finalizing lazy classes)
+static BinarySchema BuildSchema(const SnReflect& reflect, TypeHash class_hash) {
+    BinarySchema schema { };
+    auto class_it = reflect.classes.find(class_hash);
+    auto info_it = reflect.member_info.find(class_hash);
+    schema.class_name = (class_it != reflect.classes.end()) ? class_it->second.name : unknown_type.name;
+    if (info_it == reflect.member_info.end()) return schema;
+    for (const MemberInfo& member : info_it->second) {
+        BinarySchemaMember stored { };
+        stored.name =   member.name;
+        stored.size =   static_cast<uint32_t>(member.size);
+        stored.offset = static_cast<uint32_t>(member.offset);
+        stored.descriptor = member.descriptor;
+        if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+            stored.encoding = BINARY_RAW;
+        } else if (member.thunks != nullptr && member.thunks->write != nullptr && member.thunks->read != nullptr) {
+            stored.encoding = BINARY_BLOB;
+        } else {
+            continue;
+        }
+        schema.members.push_back(stored);
+    }
+    return schema;
+}
+
+BinarySchema ReflectSchema(TypeHash class_hash) {
+    g_reflect->Require(class_hash);
+    return BuildSchema(*g_reflect, class_hash);
+}
+
+void BinaryWriteString(std::vector<char>& buffer, const std::string& str) {
+    uint32_t length = static_cast<uint32_t>(str.size());
+    BinaryAppend(buffer, &length, sizeof(length));
+    BinaryAppend(buffer, str.data(), str.size());
+}
+bool BinaryReadString(const char*& cursor, const char* end, std::string& str) {
+    uint32_t length = 0;
+    if (!BinaryTake(cursor, end, &length, sizeof(length)) || static_cast<size_t>(end - cursor) < length) return false;
+    str.assign(cursor, length);
+    cursor += length;
+    return true;
+}
+
+void ReflectWriteSchema(std::vector<char>& buffer, const BinarySchema& schema) {
+    BinaryAppend(buffer, "RFL2", 4);
+    BinaryWriteString(buffer, schema.class_name);
+    uint32_t member_count = static_cast<uint32_t>(schema.members.size());
+    BinaryAppend(buffer, &member_count, sizeof(member_count));
+    for (const BinarySchemaMember& member : schema.members) {
+        BinaryWriteString(buffer, member.name);
+        BinaryAppend(buffer, &member.size, sizeof(member.size));
+        BinaryAppend(buffer, &member.offset, sizeof(member.offset));
+        BinaryAppend(buffer, &member.encoding, sizeof(member.encoding));
+        BinaryAppend(buffer, &member.descriptor, sizeof(member.descriptor));
+    }
+    BinaryAppend(buffer, &schema.record_count, sizeof(schema.record_count));
+}
+
+bool ReflectReadSchema(const char*& cursor, const char* end, BinarySchema& schema) {
+    char magic[4];
+    if (!BinaryTake(cursor, end, magic, 4) || memcmp(magic, "RFL", 3) != 0 || (magic[3] != '1' && magic[3] != '2')) return false;
+    bool descriptors = (magic[3] == '2');
+    if (!BinaryReadString(cursor, end, schema.class_name)) return false;
+    uint32_t member_count = 0;
+    if (!BinaryTake(cursor, end, &member_count, sizeof(member_count))) return false;
+    schema.members.clear();
+    for (uint32_t i = 0; i < member_count; ++i) {
+        BinarySchemaMember member { };
+        if (!BinaryReadString(cursor, end, member.name)) return false;
+        if (!BinaryTake(cursor, end, &member.size, sizeof(member.size))) return false;
+        if (!BinaryTake(cursor, end, &member.offset, sizeof(member.offset))) return false;
+        if (!BinaryTake(cursor, end, &member.encoding, sizeof(member.encoding))) return false;
+        if (descriptors && !BinaryTake(cursor, end, &member.descriptor, sizeof(member.descriptor))) return false;
+        schema.members.push_back(member);
+    }
+    return BinaryTake(cursor, end, &schema.record_count, sizeof(schema.record_count));
+}
+
+// Adds a step to a plan, merging raw steps that are adjacent in both the record and the class
+void AddBinaryOp(std::vector<BinaryOp>& plan, const BinaryOp& op) {
+    if (op.encoding == BINARY_RAW && !plan.empty() && plan.back().encoding == BINARY_RAW) {
+        BinaryOp& last = plan.back();
+        bool skip_both = (last.offset < 0 && op.offset < 0);
+        bool adjacent =  (last.offset >= 0 && op.offset >= 0 && static_cast<size_t>(last.offset) + last.size == static_cast<size_t>(op.offset));
+        if (skip_both || adjacent) {
+            last.size += op.size;
+            return;
+        }
+    }
+    plan.push_back(op);
+}
+
+bool ReflectWrite(std::vector<char>& buffer, const void* objects, size_t count, TypeHash class_hash) {
+    const TypeData* class_data = TryClassData(class_hash);
+    if (class_data == nullptr) return false;
+    BinarySchema schema = ReflectSchema(class_hash);
+    schema.record_count = count;
+    ReflectWriteSchema(buffer, schema);
+
+    // Build write plan once for all records
+    std::vector<BinaryOp> plan { };
+    for (const BinarySchemaMember& stored : schema.members) {
+        BinaryOp op { };
+        op.offset =     static_cast<int>(stored.offset);
+        op.size =       stored.size;
+        op.encoding =   stored.encoding;
+        if (stored.encoding == BINARY_BLOB) op.member = TryMemberInfo(class_hash, stored.name.c_str());
+        AddBinaryOp(plan, op);
+    }
+
+    const char* object = (const char*)(objects);
+    for (size_t i = 0; i < count; ++i, object += class_data->size) {
+        for (const BinaryOp& op : plan) {
+            if (op.encoding == BINARY_RAW) {
+                BinaryAppend(buffer, object + op.offset, op.size);
+            } else {
+                size_t length_at = buffer.size();
+                uint32_t length = 0;
+                BinaryAppend(buffer, &length, sizeof(length));
+                op.member->thunks->write(buffer, object + op.offset);
+                length = static_cast<uint32_t>(buffer.size() - length_at - sizeof(length));
+                memcpy(buffer.data() + length_at, &length, sizeof(length));
+            }
+        }
+    }
+    return true;
+}
+
+size_t ReflectRead(const char* data, size_t length, void* objects, size_t max_count, TypeHash class_hash, size_t* bytes_read) {
+    const char* cursor = data;
+    const char* end = data + length;
+    const TypeData* class_data = TryClassData(class_hash);
+    BinarySchema schema { };
+    if (class_data == nullptr || !ReflectReadSchema(cursor, end, schema) || schema.class_name != class_data->name) return 0;
+
+    // Stored members are mapped to current members once per stored schema (cached migration plan)
+    const MigrationPlan& plan = ReflectMigrationPlan(schema, class_hash);
+
+    size_t records = 0;
+    char* object = (char*)(objects);
+    for (; records < schema.record_count && records < max_count; ++records, object += class_data->size) {
+        bool ok = true;
+        for (const MigrateOp& op : plan.ops) {
+            if (op.op == MIGRATE_DEFAULT) {
+                if (op.thunks->destroy != nullptr) op.thunks->destroy(object + op.offset);
+                op.thunks->construct(object + op.offset);
+            } else if (op.encoding == BINARY_RAW) {
+                if (static_cast<size_t>(end - cursor) < op.size) { ok = false; break; }
+                if (op.op == MIGRATE_COPY) memcpy(object + op.offset, cursor, op.size);
+                else if (op.op == MIGRATE_CONVERT && !op.read(cursor, op.size, object + op.offset)) { ok = false; break; }
+                cursor += op.size;
+            } else {
+                uint32_t blob_length = 0;
+                if (!BinaryTake(cursor, end, &blob_length, sizeof(blob_length)) || static_cast<size_t>(end - cursor) < blob_length) { ok = false; break; }
+                if (op.read != nullptr && !op.read(cursor, blob_length, object + op.offset)) { ok = false; break; }
+                cursor += blob_length;
+            }
+        }
+        if (!ok) break;
+    }
+    if (bytes_read != nullptr) *bytes_read = static_cast<size_t>(cursor - data);
+    return records;
+}
+
+//####################################################################################
+//##    Schema Versioning
+//####################################################################################
+uint64_t ReflectFingerprint(const BinarySchema& schema) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto add = [&hash](const void* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) hash = (hash ^ static_cast<uint64_t>(((const unsigned char*)(data))[i])) * 0x100000001b3ULL;
+    };
+    add(schema.class_name.data(), schema.class_name.size() + 1);
+    for (const BinarySchemaMember& member : schema.members) {
+        add(member.name.c_str(), member.name.size() + 1);
+        add(&member.size, sizeof(member.size));
+        add(&member.offset, sizeof(member.offset));
+        add(&member.encoding, sizeof(member.encoding));
+        add(&member.descriptor, sizeof(member.descriptor));
+    }
+    return hash;
+}
+
+uint64_t ReflectFingerprint(TypeHash class_hash) {
+    const TypeData* data = TryClassData(class_hash);
+    return (data != nullptr) ? data->fingerprint : 0;
+}
+
+void SnReflect::FingerprintClass(TypeHash class_hash) {
+    classes.find(class_hash)->second.fingerprint = ReflectFingerprint(BuildSchema(*this, class_hash));
+}
+
+// Key of per class migration tables
+static uint64_t MigrationKey(TypeHash class_hash, uint64_t value) {
+    return value ^ (static_cast<uint64_t>(class_hash) * 0x9e3779b97f4a7c15ULL);
+}
+
+// Adds a step to a migration plan, merging raw copies that are adjacent in both the record and the class, and skips
+static void AddMigrateOp(std::vector<MigrateOp>& ops, const MigrateOp& op) {
+    if (!ops.empty() && op.encoding == BINARY_RAW && ops.back().encoding == BINARY_RAW && ops.back().op == op.op) {
+        MigrateOp& last = ops.back();
+        if (op.op == MIGRATE_SKIP || (op.op == MIGRATE_COPY && last.offset + static_cast<int>(last.size) == op.offset)) {
+            last.size += op.size;
+            return;
+        }
+    }
+    ops.push_back(op);
+}
+
+// Maps stored members to current members by name (or migration rule), members that are missing or changed type /
+// size / encoding (without a converter) are skipped, current members not loaded from stored records are reset to
+// default. Stored members without a type descriptor (old blocks) are matched by size / encoding only.
+static void BuildMigrationPlan(MigrationPlan& plan, const BinarySchema& stored, TypeHash class_hash) {
+    const BinarySchema current = BuildSchema(*g_reflect, class_hash);
+    plan.from = ReflectFingerprint(stored);
+    plan.to = ReflectFingerprint(current);
+    plan.ops.clear();
+    std::vector<bool> loaded(current.members.size(), false);
+    for (const BinarySchemaMember& stored_member : stored.members) {
+        const char* name = stored_member.name.c_str();
+        MigrateConvertFunc convert = nullptr;
+        auto rule = g_reflect->migration_rules.find(MigrationKey(class_hash, HashString(name)));
+        if (rule != g_reflect->migration_rules.end()) {
+            name = rule->second.member.c_str();
+            convert = rule->second.convert;
+        }
+        const MemberInfo* member = TryMemberInfo(class_hash, name);
+        MigrateOp op { };
+        op.encoding =   stored_member.encoding;
+        op.size =       stored_member.size;
+        op.op =         (stored_member.encoding == BINARY_RAW) ? MIGRATE_SKIP : MIGRATE_SKIP_BLOB;
+        bool same_type = (member != nullptr) && (stored_member.descriptor == 0 || stored_member.descriptor == member->descriptor);
+        if (member != nullptr) {
+            if (convert != nullptr) {
+                op.op = MIGRATE_CONVERT;
+                op.read = convert;
+            } else if (!same_type) {
+                // Retyped without converter, skipped (member is reset to default below)
+            } else if (stored_member.encoding == BINARY_RAW && (member->flags & TYPE_FLAG_TRIVIALLY_COPYABLE) && member->size == stored_member.size) {
+                op.op = MIGRATE_COPY;
+            } else if (stored_member.encoding == BINARY_BLOB && member->thunks != nullptr && member->thunks->read != nullptr) {
+                op.op = MIGRATE_READ;
+                op.read = member->thunks->read;
+            }
+            if (op.op != MIGRATE_SKIP && op.op != MIGRATE_SKIP_BLOB) {
+                op.offset = member->offset;
+                for (size_t i = 0; i < current.members.size(); ++i) {
+                    if (current.members[i].name == member->name) loaded[i] = true;
+                }
+            }
+        }
+        AddMigrateOp(plan.ops, op);
+    }
+    for (size_t i = 0; i < current.members.size(); ++i) {
+        if (loaded[i]) continue;
+        const MemberInfo* member = TryMemberInfo(class_hash, current.members[i].name.c_str());
+        if (member == nullptr || member->thunks == nullptr || member->thunks->construct == nullptr) continue;
+        MigrateOp op { };
+        op.op =         MIGRATE_DEFAULT;
+        op.offset =     member->offset;
+        op.thunks =     member->thunks;
+        plan.ops.push_back(op);
+    }
+}
+
+const MigrationPlan& ReflectMigrationPlan(const BinarySchema& stored, TypeHash class_hash) {
+    g_reflect->Require(class_hash);
+    uint64_t key = MigrationKey(class_hash, ReflectFingerprint(stored));
+    std::lock_guard<std::mutex> lock(g_reflect->migration_mutex);
+    MigrationPlan*& plan = g_reflect->migration_plans[key];
+    if (plan == nullptr) {
+        g_reflect->migration_storage.push_back(std::unique_ptr<MigrationPlan>(new MigrationPlan()));
+        plan = g_reflect->migration_storage.back().get();
+        BuildMigrationPlan(*plan, stored, class_hash);
+    }
+    return *plan;
+}
+
+void AddMigrationRule(TypeHash class_hash, const char* stored_member, const char* member, MigrateConvertFunc convert) {
+    std::lock_guard<std::mutex> lock(g_reflect->migration_mutex);
+    MigrationRule& rule = g_reflect->migration_rules[MigrationKey(class_hash, HashString(stored_member))];
+    rule.member = member;
+    rule.convert = convert;
+    // Plans of class are rebuilt on next read (old plans stay alive, they may still be in use)
+    for (auto it = g_reflect->migration_plans.begin(); it != g_reflect->migration_plans.end(); ) {
+        bool of_class = (it->second != nullptr && MigrationKey(class_hash, it->second->from) == it->first);
+        it = of_class ? g_reflect->migration_plans.erase(it) : std::next(it);
+    }
+}
+
+//####################################################################################
+//##    Diff / Delta
+//####################################################################################
+MemberMask ReflectDiff(const void* a, const void* b, TypeHash class_hash) {
+    MemberMask mask { };
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->compare_plans.find(class_hash);
+    if (it == g_reflect->compare_plans.end()) return mask;
+    const char* a_ptr = (const char*)(a);
+    const char* b_ptr = (const char*)(b);
+    MemberInfoRange infos = MemberInfos(class_hash);
+    for (const CompareOp& op : it->second.ops) {
+        if (!op.comparable) {
+            mask.Set(op.first_member);
+        } else if (op.equal != nullptr) {
+            if (!op.equal(a_ptr + op.offset, b_ptr + op.offset)) mask.Set(op.first_member);
+        } else if (memcmp(a_ptr + op.offset, b_ptr + op.offset, op.size) != 0) {
+            // Run differs, find which members changed
+            if (op.member_count == 1) {
+                mask.Set(op.first_member);
+            } else {
+                for (int m = op.first_member; m < op.first_member + op.member_count; ++m) {
+                    const MemberInfo& member = infos[m];
+                    if (memcmp(a_ptr + member.offset, b_ptr + member.offset, member.size) != 0) mask.Set(m);
+                }
+            }
+        }
+    }
+    return mask;
+}
+
+void ReflectEncodeDelta(std::vector<char>& buffer, const void* object, const MemberMask& mask, TypeHash class_hash) {
+    MemberInfoRange infos = MemberInfos(class_hash);
+    uint64_t fingerprint = ReflectFingerprint(class_hash);
+    BinaryAppend(buffer, &fingerprint, sizeof(fingerprint));
+    uint32_t words = static_cast<uint32_t>((infos.size() + 63) / 64);
+    BinaryAppend(buffer, &words, sizeof(words));
+    for (uint32_t w = 0; w < words; ++w) {
+        uint64_t bits = mask.Word(static_cast<int>(w));
+        BinaryAppend(buffer, &bits, sizeof(bits));
+    }
+    const char* object_ptr = (const char*)(object);
+    for (const MemberInfo& member : infos) {
+        if (!mask.Test(member.index)) continue;
+        if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+            BinaryAppend(buffer, object_ptr + member.offset, member.size);
+        } else {
+            size_t length_at = buffer.size();
+            uint32_t length = 0;
+            BinaryAppend(buffer, &length, sizeof(length));
+            if (member.thunks != nullptr && member.thunks->write != nullptr) member.thunks->write(buffer, object_ptr + member.offset);
+            length = static_cast<uint32_t>(buffer.size() - length_at - sizeof(length));
+            memcpy(buffer.data() + length_at, &length, sizeof(length));
+        }
+    }
+}
+
+// Blob members decoded while validating a delta, moved into the instance once the whole delta is known to be valid
+class DeltaValues
+{
+public:
+    DeltaValues() = default;
+    DeltaValues(const DeltaValues&) = delete;
+    DeltaValues& operator=(const DeltaValues&) = delete;
+    ~DeltaValues() {
+        for (Value& value : m_values) {
+            value.member->thunks->destroy(value.storage);
+            delete[] value.storage;
+        }
+    }
+    // Decodes blob into a default constructed temporary, false (nothing kept) if the blob doesn't decode
+    bool Decode(const MemberInfo& member, const char* data, size_t length) {
+        Value value { &member, new char[member.size] };
+        member.thunks->construct(value.storage);
+        m_values.push_back(value);
+        return member.thunks->read(data, length, value.storage);
+    }
+    // Moves decoded values into instance
+    void Commit(char* object) {
+        for (Value& value : m_values) value.member->thunks->move(object + value.member->offset, value.storage);
+    }
+
+private:
+    struct Value {
+        const MemberInfo*   member;                                                 // Member value belongs to
+        char*               storage;                                                // Decoded temporary
+    };
+    std::vector<Value>      m_values    { };                                        // Decoded blob members, in delta order
+};
+
+bool ReflectApplyDelta(void* object, const char* data, size_t length, TypeHash class_hash, size_t* bytes_read) {
+    const char* cursor = data;
+    const char* end = data + length;
+    MemberInfoRange infos = MemberInfos(class_hash);
+    uint64_t fingerprint = 0;
+    if (!BinaryTake(cursor, end, &fingerprint, sizeof(fingerprint)) || fingerprint != ReflectFingerprint(class_hash)) return false;
+    uint32_t words = 0;
+    if (!BinaryTake(cursor, end, &words, sizeof(words)) || words > static_cast<uint32_t>((infos.size() + 63) / 64)) return false;
+    MemberMask mask { };
+    for (uint32_t w = 0; w < words; ++w) {
+        uint64_t bits = 0;
+        if (!BinaryTake(cursor, end, &bits, sizeof(bits))) return false;
+        mask.SetWord(static_cast<int>(w), bits);
+    }
+
+    // Validate whole delta (and decode blobs into temporaries) first, the instance is untouched on malformed data
+    const char* values_at = cursor;
+    DeltaValues blobs { };
+    for (const MemberInfo& member : infos) {
+        if (!mask.Test(member.index)) continue;
+        if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+            if (static_cast<size_t>(end - cursor) < member.size) return false;
+            cursor += member.size;
+        } else {
+            uint32_t blob_length = 0;
+            if (!BinaryTake(cursor, end, &blob_length, sizeof(blob_length)) || static_cast<size_t>(end - cursor) < blob_length) return false;
+            bool decodes = (member.thunks != nullptr && member.thunks->read != nullptr && member.thunks->construct != nullptr && member.thunks->move != nullptr);
+            if (decodes && !blobs.Decode(member, cursor, blob_length)) return false;
+            cursor += blob_length;
+        }
+    }
+
+    // Apply
+    char* object_ptr = (char*)(object);
+    const char* values = values_at;
+    for (const MemberInfo& member : infos) {
+        if (!mask.Test(member.index)) continue;
+        if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+            memcpy(object_ptr + member.offset, values, member.size);
+            values += member.size;
+        } else {
+            uint32_t blob_length = 0;
+            memcpy(&blob_length, values, sizeof(blob_length));
+            values += sizeof(blob_length) + blob_length;
+        }
+    }
+    blobs.Commit(object_ptr);
+    if (bytes_read != nullptr) *bytes_read = static_cast<size_t>(cursor - data);
+    return true;
+}
+
+void ReflectApplyDelta(void* dst, const void* src, const MemberMask& mask, TypeHash class_hash) {
+    for (const MemberInfo& member : MemberInfos(class_hash)) {
+        if (!mask.Test(member.index)) continue;
+        if (member.flags & TYPE_FLAG_TRIVIALLY_COPYABLE) {
+            memcpy(((char*)(dst)) + member.offset, ((const char*)(src)) + member.offset, member.size);
+        } else {
+            MemberCopy(dst, src, member);
+        }
+    }
+}
+
+bool ChangeTracker::IsDirty(const void* class_ptr) const {
+    auto it = m_dirty.find(class_ptr);
+    return (it != m_dirty.end() && it->second.Any());
+}
+
+const MemberMask& ChangeTracker::Dirty(const void* class_ptr) const {
+    static const MemberMask clean { };
+    auto it = m_dirty.find(class_ptr);
+    return (it == m_dirty.end()) ? clean : it->second;
+}
+
+//####################################################################################
+//##    Hashing / Equality
+//####################################################################################
+// Mixes 64 bit word into running hash
+static uint64_t HashMix(uint64_t hash, uint64_t word) {
+    hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+    return hash ^ (hash >> 29);
+}
+// Hashes bytes 8 at a time into running hash
+static uint64_t HashBytes(uint64_t hash, const char* data, size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = HashMix(hash, word);
+    }
+    if (i < size) {
+        uint64_t word = 0;
+        memcpy(&word, data + i, size - i);
+        hash = HashMix(hash, word ^ (static_cast<uint64_t>(size - i) << 56));
+    }
+    return hash;
+}
+
+size_t ReflectHash(const void* object, TypeHash class_hash) {
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->compare_plans.find(class_hash);
+    if (it == g_reflect->compare_plans.end()) return 0;
+    const char* object_ptr = (const char*)(object);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const CompareOp& op : it->second.ops) {
+        if (!op.comparable) continue;
+        if (op.equal != nullptr) {
+            if (op.hash != nullptr) hash = HashMix(hash, static_cast<uint64_t>(op.hash(object_ptr + op.offset)));
+        } else {
+            hash = HashBytes(hash, object_ptr + op.offset, static_cast<size_t>(op.size));
+        }
+    }
+    return static_cast<size_t>(hash);
+}
+
+bool ReflectEquals(const void* a, const void* b, TypeHash class_hash) {
+    g_reflect->Require(class_hash);
+    auto it = g_reflect->compare_plans.find(class_hash);
+    if (it == g_reflect->compare_plans.end()) return false;
+    const char* a_ptr = (const char*)(a);
+    const char* b_ptr = (const char*)(b);
+    for (const CompareOp& op : it->second.ops) {
+        if (!op.comparable) return false;
+        if (op.equal != nullptr) {
+            if (!op.equal(a_ptr + op.offset, b_ptr + op.offset)) return false;
+        } else if (memcmp(a_ptr + op.offset, b_ptr + op.offset, op.size) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//####################################################################################
+//##    Memory Mapped Snapshots
+//####################################################################################
+static const size_t k_snapshot_alignment = 16;                                      // Alignment of first record within file
+
+bool ReflectWriteSnapshot(const std::string& file_name, const void* objects, size_t count, TypeHash class_hash) {
+    const TypeData* class_data = TryClassData(class_hash);
+    if (class_data == nullptr) return false;
+
+    // Header, raw members only
+    BinarySchema full = ReflectSchema(class_hash);
+    BinarySchema schema { };
+    schema.class_name = full.class_name;
+    schema.record_count = count;
+    for (const BinarySchemaMember& member : full.members) {
+        if (member.encoding == BINARY_RAW) schema.members.push_back(member);
+    }
+    std::vector<char> buffer { };
+    ReflectWriteSchema(buffer, schema);
+    uint32_t record_size = static_cast<uint32_t>(class_data->size);
+    BinaryAppend(buffer, &record_size, sizeof(record_size));
+    buffer.resize((buffer.size() + k_snapshot_alignment - 1) / k_snapshot_alignment * k_snapshot_alignment, 0);
+
+    // Records, non raw members (and padding) are zeroed
+    size_t records_at = buffer.size();
+    buffer.resize(records_at + count * record_size, 0);
+    const char* object = (const char*)(objects);
+    for (size_t i = 0; i < count; ++i, object += record_size) {
+        char* record = buffer.data() + records_at + i * record_size;
+        for (const BinarySchemaMember& member : schema.members) {
+            memcpy(record + member.offset, object + member.offset, member.size);
+        }
+    }
+
+    FILE* file = fopen(file_name.c_str(), "wb");
+    if (file == nullptr) return false;
+    bool written = (fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size());
+    return (fclose(file) == 0) && written;
+}
+
+bool SnapshotReader::Open(const std::string& file_name) {
+    Close();
+#if defined(REFLECT_HAS_MMAP)
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) { close(fd); return false; }
+    void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) return false;
+    m_data = (const char*)(mapped);
+    m_length = static_cast<size_t>(info.st_size);
+#else
+    FILE* file = fopen(file_name.c_str(), "rb");
+    if (file == nullptr) return false;
+    char chunk[4096];
+    size_t read = 0;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) m_fallback.insert(m_fallback.end(), chunk, chunk + read);
+    fclose(file);
+    m_data = m_fallback.data();
+    m_length = m_fallback.size();
+#endif
+
+    // Parse header
+    const char* cursor = m_data;
+    const char* end = m_data + m_length;
+    uint32_t record_size = 0;
+    if (!ReflectReadSchema(cursor, end, m_schema) || !BinaryTake(cursor, end, &record_size, sizeof(record_size))) { Close(); return false; }
+    size_t records_at = (static_cast<size_t>(cursor - m_data) + k_snapshot_alignment - 1) / k_snapshot_alignment * k_snapshot_alignment;
+    if (record_size == 0 || records_at > m_length || (m_length - records_at) / record_size < m_schema.record_count) { Close(); return false; }
+    // Members are read in place, every member must lie within a record
+    for (const BinarySchemaMember& member : m_schema.members) {
+        if (member.offset > record_size || member.size > record_size - member.offset) { Close(); return false; }
+    }
+    m_records = m_data + records_at;
+    m_record_size = record_size;
+    return true;
+}
+
+void SnapshotReader::Close() {
+#if defined(REFLECT_HAS_MMAP)
+    if (m_data != nullptr) munmap((void*)(m_data), m_length);
+#endif
+    m_fallback.clear();
+    m_schema = BinarySchema();
+    m_data = nullptr;
+    m_length = 0;
+    m_records = nullptr;
+    m_record_size = 0;
+}
+
+SnapshotMember SnapshotReader::Member(const char* member_name) const {
+    SnapshotMember result { };
+    for (const BinarySchemaMember& member : m_schema.members) {
+        if (member.name == member_name) {
+            result.offset = static_cast<int>(member.offset);
+            result.size = member.size;
+            break;
+        }
+    }
+    return result;
+}
+
+SnapshotMember SnapshotReader::Member(const MemberInfo& member_info) const {
+    for (const BinarySchemaMember& member : m_schema.members) {
+        if (member.name != member_info.name) continue;
+        bool same_type = (member.descriptor == 0 || member.descriptor == member_info.descriptor);
+        if (member.size != member_info.size || !same_type) break;
+        SnapshotMember result { };
+        result.offset = static_cast<int>(member.offset);
+        result.size = member.size;
+        return result;
+    }
+    return SnapshotMember();
 }
 
 //####################################################################################
 //##    Meta Data (User Info)
 //####################################################################################
-void SetMetaData(TypeData& type_data, int key, std::string data) {
-    if (type_data.type_hash != 0) type_data.meta_int_map[key] = data;
+static bool ReflectionFrozen() {
+    SnReflect* target = RegistrationTarget();
+    return (target != nullptr && target->frozen);
+}
+static bool MetaEntryLess(const MetaEntry& entry, const MetaEntry& other) {
+    return (entry.string_key != other.string_key) ? (entry.string_key < other.string_key) : (entry.key < other.key);
+}
+static void UpsertMetaEntry(MetaList& list, size_t key, bool string_key, const MetaValue& data) {
+    MetaEntry entry { };
+    entry.key = key;
+    entry.string_key = string_key;
+    auto it = std::lower_bound(list.begin(), list.end(), entry, MetaEntryLess);
+    if (it != list.end() && it->key == key && it->string_key == string_key) {
+        it->value = data;
+    } else {
+        entry.value = data;
+        list.insert(it, entry);
+    }
+}
+static void SetMetaEntry(TypeData& type_data, size_t key, bool string_key, const MetaValue& data) {
+    if (type_data.type_hash == 0) return;
+    if (!ReflectionFrozen()) {
+        UpsertMetaEntry(type_data.meta_data, key, string_key, data);
+        return;
+    }
+    // Registry is frozen, readers may hold the current list, publish an updated copy instead
+    std::lock_guard<std::mutex> lock(g_reflect->meta_mutex);
+    const MetaList* current = type_data.meta_snapshot.list.load(std::memory_order_relaxed);
+    std::unique_ptr<MetaList> list { };
+    if (g_reflect->meta_free.empty()) {
+        list.reset(new MetaList((current != nullptr) ? *current : type_data.meta_data));
+    } else {
+        list = std::move(g_reflect->meta_free.back());
+        g_reflect->meta_free.pop_back();
+        *list = (current != nullptr) ? *current : type_data.meta_data;
+    }
+    UpsertMetaEntry(*list, key, string_key, data);
+    type_data.meta_snapshot.list.store(list.get(), std::memory_order_release);
+    std::unique_ptr<MetaList>& owned = g_reflect->meta_lists[&type_data];
+    if (owned != nullptr) g_reflect->meta_retired.push_back(std::move(owned));
+    owned = std::move(list);
+}
+static const MetaValue& GetMetaEntry(const TypeData& type_data, size_t key, bool string_key) {
+    static const MetaValue empty { };
+    const MetaList* list = type_data.meta_snapshot.list.load(std::memory_order_acquire);
+    if (list == nullptr) list = &type_data.meta_data;
+    MetaEntry entry { };
+    entry.key = key;
+    entry.string_key = string_key;
+    auto it = std::lower_bound(list->begin(), list->end(), entry, MetaEntryLess);
+    return (it != list->end() && it->key == key && it->string_key == string_key) ? it->value : empty;
+}
+void SetMetaData(TypeData& type_data, int key, const MetaValue& data) {
+    SetMetaEntry(type_data, static_cast<size_t>(key), false, data);
+}
+void SetMetaData(TypeData& type_data, const char* key, const MetaValue& data) {
+    size_t key_hash = HashString(key);
+    // Interned after InitializeReflection() too (guarded by meta_key_mutex), so MetaKeyName() knows keys first set at runtime
+    if (RegistrationTarget() != nullptr) RegistrationTarget()->InternMetaKey(key_hash, key);
+    SetMetaEntry(type_data, key_hash, true, data);
+}
+void SetMetaData(TypeData& type_data, const std::string& key, const MetaValue& data) {
+    SetMetaData(type_data, key.c_str(), data);
+}
+const MetaValue& GetMetaValue(const TypeData& type_data, int key)                   { return GetMetaEntry(type_data, static_cast<size_t>(key), false); }
+const MetaValue& GetMetaValue(const TypeData& type_data, const char* key)           { return GetMetaEntry(type_data, HashString(key), true); }
+const MetaValue& GetMetaValue(const TypeData& type_data, const std::string& key)    { return GetMetaEntry(type_data, HashString(key.c_str()), true); }
+const MetaValue& GetMetaValue(const TypeData& type_data, NameHash key)              { return GetMetaEntry(type_data, key.value, true); }
+const std::string& GetMetaData(const TypeData& type_data, int key)                  { return GetMetaValue(type_data, key).string; }
+const std::string& GetMetaData(const TypeData& type_data, const char* key)          { return GetMetaValue(type_data, key).string; }
+const std::string& GetMetaData(const TypeData& type_data, const std::string& key)   { return GetMetaValue(type_data, key).string; }
+const std::string& GetMetaData(const TypeData& type_data, NameHash key)             { return GetMetaValue(type_data, key).string; }
+const std::string& MetaKeyName(size_t key_hash) {
+    static const std::string empty { };
+    if (g_reflect == nullptr) return empty;
+    std::lock_guard<std::mutex> lock(g_reflect->meta_key_mutex);
+    auto it = g_reflect->meta_keys.find(key_hash);
+    return (it != g_reflect->meta_keys.end()) ? it->second : empty;
+}
+void ReclaimMetaData() {
+    // Keeps a few released lists for reuse (their capacity makes later writes allocation free), frees the rest
+    const size_t k_free_lists = 64;
+    if (g_reflect == nullptr) return;
+    std::lock_guard<std::mutex> lock(g_reflect->meta_mutex);
+    for (std::unique_ptr<MetaList>& list : g_reflect->meta_retired) {
+        if (g_reflect->meta_free.size() < k_free_lists) g_reflect->meta_free.push_back(std::move(list));
+    }
+    g_reflect->meta_retired.clear();
+}
+
+//####################################################################################
+//##    Parallel Instance Iteration
+//####################################################################################
+#ifndef REFLECT_NO_THREADS
+// Chunks are claimed from a shared atomic cursor until none are left
+struct ParallelJob {
+    std::atomic<size_t> next            { 0 };                                      // First index of next unclaimed chunk
+    size_t              count           { 0 };                                      // Total number of items
+    size_t              grain           { 1 };                                      // Items per chunk
+    void                (*func)(void*, size_t, size_t) { nullptr };                 // Chunk function
+    void*               context         { nullptr };                                // Chunk function context
+};
+static void RunParallelJob(ParallelJob* job) {
+    for (;;) {
+        size_t first = job->next.fetch_add(job->grain, std::memory_order_relaxed);
+        if (first >= job->count) break;
+        size_t last = (job->count - first < job->grain) ? job->count : first + job->grain;
+        job->func(job->context, first, last);
+    }
 }
-void SetMetaData(TypeData& type_data, std::string key, std::string data) {
-    if (type_data.type_hash != 0) type_data.meta_string_map[key] = data;
+
+// Persistent workers for ReflectParallelFor(), started on first use (grows to the largest thread count asked for) and
+// joined at exit. Runs one job at a time, a call that finds the pool busy (nested or concurrent calls) or comes from
+// a pool worker runs its job on the calling thread instead.
+static thread_local bool t_parallel_worker { false };
+class ParallelPool
+{
+public:
+    static ParallelPool& Get() { static ParallelPool pool; return pool; }
+    ~ParallelPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (std::thread& worker : m_workers) worker.join();
+    }
+
+    // Runs job on calling thread and up to 'helpers' workers, false (job not started) if pool is busy
+    bool Run(ParallelJob& job, size_t helpers) {
+        if (t_parallel_worker) return false;
+        std::unique_lock<std::mutex> busy(m_run_mutex, std::try_to_lock);
+        if (!busy.owns_lock()) return false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            while (m_workers.size() < helpers) m_workers.push_back(std::thread(&ParallelPool::Work, this));
+            m_job = &job;
+            m_open = helpers;
+            m_running = 0;
+            ++m_epoch;
+        }
+        m_wake.notify_all();
+        RunParallelJob(&job);
+        // All chunks are claimed, close job to workers that haven't joined yet and wait for the ones that have
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_open = 0;
+        m_done.wait(lock, [this]() { return m_running == 0; });
+        m_job = nullptr;
+        return true;
+    }
+
+private:
+    void Work() {
+        t_parallel_worker = true;
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_wake.wait(lock, [&]() { return m_stop || (m_epoch != seen && m_open > 0); });
+            if (m_stop) return;
+            seen = m_epoch;
+            --m_open;
+            ++m_running;
+            ParallelJob* job = m_job;
+            lock.unlock();
+            RunParallelJob(job);
+            lock.lock();
+            if (--m_running == 0) m_done.notify_one();
+        }
+    }
+
+    std::mutex                  m_run_mutex     { };                                // Held by the caller of the running job
+    std::mutex                  m_mutex         { };                                // Guards job state below
+    std::condition_variable     m_wake          { };                                // Signals workers a new job (or exit)
+    std::condition_variable     m_done          { };                                // Signals caller the last running worker finished
+    std::vector<std::thread>    m_workers       { };
+    ParallelJob*                m_job           { nullptr };                        // Current job
+    uint64_t                    m_epoch         { 0 };                              // Incremented per job, so a worker joins each job once
+    size_t                      m_open          { 0 };                              // Workers that may still join current job
+    size_t                      m_running       { 0 };                              // Workers running current job
+    bool                        m_stop          { false };
+};
+#endif
+
+void ReflectParallelFor(size_t count, size_t grain, int thread_count, void (*func)(void* context, size_t first, size_t last), void* context) {
+    if (count == 0) return;
+    size_t threads = 1;
+    #ifndef REFLECT_NO_THREADS
+        threads = (thread_count > 0) ? static_cast<size_t>(thread_count) : static_cast<size_t>(std::thread::hardware_concurrency());
+        threads = std::max<size_t>(1, threads);
+    #else
+        (void)thread_count;
+    #endif
+    // Default grain gives each thread several chunks to balance uneven work, small counts stay on calling thread
+    if (grain == 0) grain = std::max<size_t>(256, count / (threads * 8));
+    threads = std::min(threads, (count + grain - 1) / grain);
+    if (threads <= 1) {
+        func(context, 0, count);
+        return;
+    }
+    #ifndef REFLECT_NO_THREADS
+        ParallelJob job;
+        job.count =     count;
+        job.grain =     grain;
+        job.func =      func;
+        job.context =   context;
+        if (!ParallelPool::Get().Run(job, threads - 1)) func(context, 0, count);
+    #endif
+}
+
+//####################################################################################
+//##    Object Construction / Pools
+//####################################################################################
+void* ReflectConstruct(void* memory, TypeHash class_hash) {
+    const TypeData* data = TryClassData(class_hash);
+    if (memory == nullptr || data == nullptr || data->thunks == nullptr || data->thunks->construct == nullptr) return nullptr;
+    data->thunks->construct(memory);
+    return memory;
 }
-std::string GetMetaData(TypeData& type_data, int key) {
-    if (type_data.type_hash != 0) {
-        if (type_data.meta_int_map.find(key) != type_data.meta_int_map.end())
-            return type_data.meta_int_map[key];
+
+bool ReflectDestroy(void* object, TypeHash class_hash) {
+    const TypeData* data = TryClassData(class_hash);
+    if (object == nullptr || data == nullptr || data->thunks == nullptr) return false;
+    data->thunks->destroy(object);
+    return true;
+}
+
+ReflectPool::ReflectPool(TypeHash class_hash, size_t slab_count) {
+    m_class_hash = class_hash;
+    m_slab_count = (slab_count > 0) ? slab_count : 1;
+    const TypeData* data = TryClassData(class_hash);
+    if (data == nullptr || data->thunks == nullptr || data->thunks->construct == nullptr) return;
+    m_thunks = data->thunks;
+    m_alignment = (data->alignment > alignof(void*)) ? data->alignment : alignof(void*);
+    size_t size = (data->size > sizeof(void*)) ? data->size : sizeof(void*);
+    m_slot_size = (size + m_alignment - 1) & ~(m_alignment - 1);
+}
+
+ReflectPool::~ReflectPool() {
+    Clear();
+    for (Slab& slab : m_slabs) REFLECT_FREE(slab.raw);
+}
+
+bool ReflectPool::AddSlab() {
+    Slab slab { };
+    slab.raw = static_cast<char*>(REFLECT_MALLOC(m_slot_size * m_slab_count + m_alignment));
+    if (slab.raw == nullptr) return false;
+    slab.data = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(slab.raw) + m_alignment - 1) & ~(static_cast<uintptr_t>(m_alignment) - 1));
+    slab.live.assign((m_slab_count + 63) / 64, 0);
+    // Free list in slot order, so new instances are handed out contiguously
+    for (size_t i = m_slab_count; i > 0; --i) PushFree(slab.data + (i - 1) * m_slot_size);
+    auto at = std::upper_bound(m_slabs.begin(), m_slabs.end(), slab.data, [](const char* data, const Slab& other) { return data < other.data; });
+    m_slabs.insert(at, std::move(slab));
+    return true;
+}
+
+ReflectPool::Slab* ReflectPool::FindSlab(const void* instance, size_t& slot) {
+    const char* ptr = (const char*)(instance);
+    auto at = std::upper_bound(m_slabs.begin(), m_slabs.end(), ptr, [](const char* data, const Slab& other) { return data < other.data; });
+    if (at == m_slabs.begin()) return nullptr;
+    Slab& slab = *(at - 1);
+    size_t offset = static_cast<size_t>(ptr - slab.data);
+    if (offset >= m_slot_size * m_slab_count || offset % m_slot_size != 0) return nullptr;
+    slot = offset / m_slot_size;
+    return &slab;
+}
+
+void ReflectPool::PushFree(void* slot) {
+    memcpy(slot, &m_free, sizeof(void*));
+    m_free = slot;
+}
+
+void* ReflectPool::Create() {
+    if (m_thunks == nullptr) return nullptr;
+    if (m_free == nullptr && !AddSlab()) return nullptr;
+    void* instance = m_free;
+    memcpy(&m_free, instance, sizeof(void*));
+    size_t slot = 0;
+    Slab* slab = FindSlab(instance, slot);
+    slab->live[slot >> 6] |= (1ULL << (slot & 63));
+    m_thunks->construct(instance);
+    ++m_live;
+    return instance;
+}
+
+size_t ReflectPool::Create(void** instances, size_t count) {
+    if (m_thunks == nullptr) return 0;
+    for (size_t i = 0; i < count; ++i) {
+        instances[i] = Create();
+        if (instances[i] == nullptr) return i;
     }
-    return "";
+    return count;
+}
+
+void ReflectPool::Destroy(void* instance) {
+    size_t slot = 0;
+    Slab* slab = (instance != nullptr) ? FindSlab(instance, slot) : nullptr;
+    assert((instance == nullptr || (slab != nullptr && (slab->live[slot >> 6] & (1ULL << (slot & 63))))) &&
+        "Instance was not created by this pool or was already destroyed!");
+    if (slab == nullptr || !(slab->live[slot >> 6] & (1ULL << (slot & 63)))) return;
+    m_thunks->destroy(instance);
+    slab->live[slot >> 6] &= ~(1ULL << (slot & 63));
+    PushFree(instance);
+    --m_live;
 }
-std::string GetMetaData(TypeData& type_data, std::string key) {
-    if (type_data.type_hash != 0) {
-        if (type_data.meta_string_map.find(key) != type_data.meta_string_map.end())
-            return type_data.meta_string_map[key];
+
+void ReflectPool::Destroy(void* const* instances, size_t count) {
+    for (size_t i = 0; i < count; ++i) Destroy(instances[i]);
+}
+
+void ReflectPool::Clear() {
+    m_free = nullptr;
+    for (size_t s = m_slabs.size(); s > 0; --s) {
+        Slab& slab = m_slabs[s - 1];
+        for (size_t i = m_slab_count; i > 0; --i) {
+            size_t slot = i - 1;
+            char* instance = slab.data + slot * m_slot_size;
+            if (slab.live[slot >> 6] & (1ULL << (slot & 63))) m_thunks->destroy(instance);
+            PushFree(instance);
+        }
+        std::fill(slab.live.begin(), slab.live.end(), 0);
     }
-    return "";
+    m_live = 0;
 }
 
 #endif  // REGISTER_REFLECTION
@@ -0,0 +1,312 @@
+//
+// Description:     Reflect, C++ 11 Reflection Library
+// Author:          Stephens Nunnally and Scidian Software
+// License:         Distributed under the MIT License
+// Source(s):       https://github.com/stevinz/reflect
+//
+// Copyright (c) 2021 Stephens Nunnally and Scidian Software
+//
+//
+//####################################################################################
+//##    Reflection Checks
+//##        Round trip, truncated and corrupt input checks for the binary formats, run
+//##        with ctest (exits with 1 when any check fails)
+//####################################################################################
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define REGISTER_REFLECTION
+#include "reflect.h"
+
+static int g_failures = 0;
+#define CHECK(EXPR) \
+    do { if (!(EXPR)) { ++g_failures; std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #EXPR); } } while (0)
+
+//####################################################################################
+//##    Checked Types
+//############################
+struct CheckItem {
+    int id;
+    float weight;
+    std::string name;
+    std::vector<int> tags;
+    REFLECT();
+};
+REFLECT_CLASS(CheckItem)
+REFLECT_MEMBER(id)
+REFLECT_MEMBER(weight)
+REFLECT_MEMBER(name)
+REFLECT_MEMBER(tags)
+REFLECT_END(CheckItem)
+
+// Other class with the same member names, records of one must never load into the other
+struct CheckOther {
+    int id;
+    float weight;
+    std::string name;
+    std::vector<int> tags;
+    REFLECT();
+};
+REFLECT_CLASS(CheckOther)
+REFLECT_MEMBER(id)
+REFLECT_MEMBER(weight)
+REFLECT_MEMBER(name)
+REFLECT_MEMBER(tags)
+REFLECT_END(CheckOther)
+
+// Trivially copyable, snapshots store raw members only
+struct CheckSample {
+    int id;
+    float x;
+    double y;
+    REFLECT();
+};
+REFLECT_CLASS(CheckSample)
+REFLECT_MEMBER(id)
+REFLECT_MEMBER(x)
+REFLECT_MEMBER(y)
+REFLECT_END(CheckSample)
+
+static bool SameItem(const CheckItem& a, const CheckItem& b) {
+    return a.id == b.id && a.weight == b.weight && a.name == b.name && a.tags == b.tags;
+}
+static std::vector<CheckItem> MakeItems() {
+    std::vector<CheckItem> items(3);
+    items[0].id = 1;    items[0].weight = 0.5f;     items[0].name = "first";                        items[0].tags = { 1, 2 };
+    items[1].id = 2;    items[1].weight = -1.0f;    items[1].name = "";                             items[1].tags = { };
+    items[2].id = 3;    items[2].weight = 2.25f;    items[2].name = "a name past the small buffer"; items[2].tags = { 7, 8 };
+    return items;
+}
+
+//####################################################################################
+//##    Binary Serialization
+//############################
+static void CheckBinary() {
+    std::vector<CheckItem> items = MakeItems();
+    std::vector<char> buffer;
+    CHECK(ReflectWrite(buffer, items.data(), items.size(), TypeHashID<CheckItem>()));
+
+    // Round trip
+    std::vector<CheckItem> loaded(items.size());
+    size_t bytes_read = 0;
+    CHECK(ReflectRead(buffer.data(), buffer.size(), loaded.data(), loaded.size(), TypeHashID<CheckItem>(), &bytes_read) == items.size());
+    CHECK(bytes_read == buffer.size());
+    for (size_t i = 0; i < items.size(); ++i) CHECK(SameItem(loaded[i], items[i]));
+
+    // Truncated blocks only return the complete records before the cut
+    for (size_t length = 0; length < buffer.size(); ++length) {
+        std::vector<CheckItem> partial(items.size());
+        size_t read = ReflectRead(buffer.data(), length, partial.data(), partial.size(), TypeHashID<CheckItem>());
+        CHECK(read < items.size());
+        for (size_t i = 0; i < read; ++i) CHECK(SameItem(partial[i], items[i]));
+    }
+
+    // Blob that doesn't decode (element count of last record's tags past the blob) fails that record
+    std::vector<char> corrupt = buffer;
+    uint32_t count = 0xffffff;
+    memcpy(corrupt.data() + corrupt.size() - 2 * sizeof(int) - sizeof(uint32_t), &count, sizeof(count));
+    std::vector<CheckItem> failed(items.size());
+    CHECK(ReflectRead(corrupt.data(), corrupt.size(), failed.data(), failed.size(), TypeHashID<CheckItem>()) == 2);
+    CHECK(SameItem(failed[0], items[0]) && SameItem(failed[1], items[1]));
+
+    // Wrong magic / wrong class
+    corrupt = buffer;
+    corrupt[0] = 'X';
+    CHECK(ReflectRead(corrupt.data(), corrupt.size(), failed.data(), failed.size(), TypeHashID<CheckItem>()) == 0);
+    std::vector<CheckOther> others(items.size());
+    CHECK(ReflectRead(buffer.data(), buffer.size(), others.data(), others.size(), TypeHashID<CheckOther>()) == 0);
+}
+
+//####################################################################################
+//##    Memory Mapped Snapshots
+//############################
+static bool WriteFile(const char* file_name, const std::vector<char>& data) {
+    FILE* file = fopen(file_name, "wb");
+    if (file == nullptr) return false;
+    bool written = data.empty() || fwrite(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return written;
+}
+static std::vector<char> ReadFile(const char* file_name) {
+    std::vector<char> data;
+    FILE* file = fopen(file_name, "rb");
+    if (file == nullptr) return data;
+    char chunk[4096];
+    size_t read = 0;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) data.insert(data.end(), chunk, chunk + read);
+    fclose(file);
+    return data;
+}
+
+static void CheckSnapshot() {
+    const char* file_name = "reflect_check.snapshot";
+    std::vector<CheckSample> samples(4);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i].id = static_cast<int>(i) + 10;
+        samples[i].x = static_cast<float>(i) * 0.5f;
+        samples[i].y = static_cast<double>(i) * -3.0;
+    }
+
+    // Round trip, fields read in place
+    CHECK(ReflectWriteSnapshot(file_name, samples.data(), samples.size(), TypeHashID<CheckSample>()));
+    std::vector<char> file = ReadFile(file_name);
+    {
+        SnapshotReader reader;
+        CHECK(reader.Open(file_name));
+        CHECK(reader.RecordCount() == samples.size());
+        SnapshotMember id = reader.Member("id");
+        SnapshotMember y = reader.Member(GetMemberInfo(TypeHashID<CheckSample>(), 2));
+        CHECK(id.valid() && y.valid() && !reader.Member("missing").valid());
+        for (size_t i = 0; i < samples.size() && id.valid() && y.valid(); ++i) {
+            CHECK(reader.Get<int>(i, id) == samples[i].id);
+            CHECK(reader.Get<double>(i, y) == samples[i].y);
+        }
+    }
+
+    // Truncated files (header or records cut off) don't open
+    SnapshotReader reader;
+    for (size_t length = 0; length < file.size(); length += 7) {
+        CHECK(WriteFile(file_name, std::vector<char>(file.begin(), file.begin() + length)));
+        CHECK(!reader.Open(file_name));
+    }
+
+    // Member stored past the end of the record doesn't open
+    BinarySchema schema = ReflectSchema(TypeHashID<CheckSample>());
+    schema.record_count = 1;
+    schema.members.back().offset = 1000;
+    std::vector<char> corrupt;
+    ReflectWriteSchema(corrupt, schema);
+    uint32_t record_size = sizeof(CheckSample);
+    corrupt.insert(corrupt.end(), (const char*)(&record_size), (const char*)(&record_size) + sizeof(record_size));
+    corrupt.resize((corrupt.size() + 15) / 16 * 16 + sizeof(CheckSample), 0);
+    CHECK(WriteFile(file_name, corrupt));
+    CHECK(!reader.Open(file_name));
+
+    std::remove(file_name);
+    CHECK(!reader.Open(file_name));
+}
+
+//####################################################################################
+//##    Diff / Delta
+//############################
+static void CheckDelta() {
+    std::vector<CheckItem> items = MakeItems();
+    CheckItem before = items[0];
+    CheckItem after = items[0];
+    after.weight = 4.0f;
+    after.tags = { 3, 4 };
+
+    // Only changed members are encoded, applying them onto the old value gives the new one
+    MemberMask mask = ReflectDiff(before, after);
+    CHECK(!mask.Test(0) && mask.Test(1) && !mask.Test(2) && mask.Test(3));
+    std::vector<char> delta;
+    ReflectEncodeDelta(delta, &after, mask, TypeHashID<CheckItem>());
+    CheckItem applied = before;
+    size_t bytes_read = 0;
+    CHECK(ReflectApplyDelta(&applied, delta.data(), delta.size(), TypeHashID<CheckItem>(), &bytes_read));
+    CHECK(bytes_read == delta.size());
+    CHECK(SameItem(applied, after));
+
+    // Truncated deltas are rejected without touching the instance
+    for (size_t length = 0; length < delta.size(); ++length) {
+        CheckItem untouched = before;
+        CHECK(!ReflectApplyDelta(&untouched, delta.data(), length, TypeHashID<CheckItem>()));
+        CHECK(SameItem(untouched, before));
+    }
+
+    // So are deltas with a member that doesn't decode (element count of tags past its blob)
+    std::vector<char> corrupt = delta;
+    uint32_t count = 0xffffff;
+    memcpy(corrupt.data() + corrupt.size() - 2 * sizeof(int) - sizeof(uint32_t), &count, sizeof(count));
+    CheckItem untouched = before;
+    CHECK(!ReflectApplyDelta(&untouched, corrupt.data(), corrupt.size(), TypeHashID<CheckItem>()));
+    CHECK(SameItem(untouched, before));
+}
+
+//####################################################################################
+//##    Schema Versioning
+//############################
+// Stored CheckSample layout of an older build: 'x' was called 'old_x', 'y' was a float
+static std::vector<char> WriteOldSamples(int id, float old_x, float y) {
+    BinarySchema schema { };
+    schema.class_name = "CheckSample";
+    schema.record_count = 1;
+    BinarySchemaMember member { };
+    member.name = "id";     member.size = sizeof(int);      member.offset = 0;  member.descriptor = TypeDescriptor<int>::Get();
+    schema.members.push_back(member);
+    member.name = "old_x";  member.size = sizeof(float);    member.offset = 4;  member.descriptor = TypeDescriptor<float>::Get();
+    schema.members.push_back(member);
+    member.name = "y";      member.size = sizeof(float);    member.offset = 8;  member.descriptor = TypeDescriptor<float>::Get();
+    schema.members.push_back(member);
+    std::vector<char> buffer;
+    ReflectWriteSchema(buffer, schema);
+    BinaryAppend(buffer, &id, sizeof(id));
+    BinaryAppend(buffer, &old_x, sizeof(old_x));
+    BinaryAppend(buffer, &y, sizeof(y));
+    return buffer;
+}
+static bool FloatToDouble(const char* data, size_t length, void* member) {
+    if (length != sizeof(float)) return false;
+    float value = 0.0f;
+    memcpy(&value, data, sizeof(value));
+    *static_cast<double*>(member) = value;
+    return true;
+}
+static bool RejectValue(const char*, size_t, void*) {
+    return false;
+}
+
+static void CheckVersioning() {
+    // Deltas of another class (different fingerprint) or with a damaged fingerprint are rejected
+    std::vector<CheckItem> items = MakeItems();
+    MemberMask mask { };
+    mask.Set(0);
+    std::vector<char> delta;
+    ReflectEncodeDelta(delta, &items[0], mask, TypeHashID<CheckItem>());
+    CheckOther other { };
+    other.id = 99;
+    CHECK(!ReflectApplyDelta(&other, delta.data(), delta.size(), TypeHashID<CheckOther>()));
+    CHECK(other.id == 99);
+    delta[0] ^= 0x01;
+    CheckItem untouched = items[1];
+    CHECK(!ReflectApplyDelta(&untouched, delta.data(), delta.size(), TypeHashID<CheckItem>()));
+    CHECK(SameItem(untouched, items[1]));
+    CHECK(ReflectFingerprint<CheckItem>() != ReflectFingerprint<CheckOther>());
+
+    // Without rules the renamed / retyped members are reset to their default value, matching members still load
+    std::vector<char> old_samples = WriteOldSamples(5, 1.5f, 2.5f);
+    CheckSample sample { 0, 9.0f, 9.0 };
+    CHECK(ReflectRead(old_samples.data(), old_samples.size(), &sample, 1, TypeHashID<CheckSample>()) == 1);
+    CHECK(sample.id == 5 && sample.x == 0.0f && sample.y == 0.0);
+
+    // Rename and retype rules
+    AddMigrationRule(TypeHashID<CheckSample>(), "old_x", "x");
+    AddMigrationRule(TypeHashID<CheckSample>(), "y", "y", FloatToDouble);
+    CHECK(ReflectRead(old_samples.data(), old_samples.size(), &sample, 1, TypeHashID<CheckSample>()) == 1);
+    CHECK(sample.id == 5 && sample.x == 1.5f && sample.y == 2.5);
+
+    // Converter that fails the value fails the record
+    AddMigrationRule(TypeHashID<CheckSample>(), "y", "y", RejectValue);
+    CHECK(ReflectRead(old_samples.data(), old_samples.size(), &sample, 1, TypeHashID<CheckSample>()) == 0);
+
+    // Truncated old records
+    AddMigrationRule(TypeHashID<CheckSample>(), "y", "y", FloatToDouble);
+    for (size_t length = 0; length < old_samples.size(); ++length) {
+        CHECK(ReflectRead(old_samples.data(), length, &sample, 1, TypeHashID<CheckSample>()) == 0);
+    }
+}
+
+//####################################################################################
+//##    Main
+//####################################################################################
+int main() {
+    InitializeReflection();
+    CheckBinary();
+    CheckSnapshot();
+    CheckDelta();
+    CheckVersioning();
+    if (g_failures == 0) std::printf("All checks passed\n");
+    return (g_failures == 0) ? 0 : 1;
+}